@@ -0,0 +1,440 @@
+/**
+ * @file basic_time.hpp
+ * @brief Time of day and timestamps at second, millisecond or microsecond precision
+ * @author zuudevs (zuudevs@gmail.com)
+ * @version 1.1.1
+ * @date 2026-10-16
+ */
+
+#pragma once
+
+#include "datetime_core.hpp"
+#include <chrono>
+#include <type_traits>
+
+namespace zuu {
+
+namespace detail {
+
+    template <typename P>
+    concept time_precision = std::same_as<P, std::chrono::seconds> || std::same_as<P, std::chrono::milliseconds> ||
+                             std::same_as<P, std::chrono::microseconds> || std::same_as<P, std::chrono::nanoseconds>;
+
+    /// Tick constants and the smallest unsigned type holding one day of ticks
+    template <typename P>
+    struct precision_traits {
+        static constexpr int64_t ticks_per_second = P::period::den;
+        static constexpr int64_t nanos_per_tick = NANOS_PER_SECOND / ticks_per_second;
+        static constexpr int64_t ticks_per_day = int64_t{SECONDS_PER_DAY} * ticks_per_second;
+        using rep = std::conditional_t<(ticks_per_day <= 0xFFFFFFFFll), uint32_t, uint64_t>;
+
+        /// Default format: seconds plus as many fraction digits as the precision carries
+        static constexpr std::string_view time_format =
+            ticks_per_second == 1 ? "%H:%M:%S" : ticks_per_second == 1000 ? "%H:%M:%S.%f" : "%H:%M:%S.%u";
+    };
+
+} // namespace detail
+
+template <typename P> class FixedTime;
+template <typename P> class FixedDateTime;
+
+/**
+ * @brief Time of day at precision P (std::chrono::seconds ... nanoseconds)
+ *
+ * @details BasicTime<std::chrono::nanoseconds> is Time itself.
+ */
+template <detail::time_precision P>
+using BasicTime = std::conditional_t<std::is_same_v<P, std::chrono::nanoseconds>, Time, FixedTime<P>>;
+
+/**
+ * @brief Timestamp at precision P (std::chrono::seconds ... nanoseconds)
+ *
+ * @details BasicDateTime<std::chrono::nanoseconds> is DateTime itself.
+ */
+template <detail::time_precision P>
+using BasicDateTime = std::conditional_t<std::is_same_v<P, std::chrono::nanoseconds>, DateTime, FixedDateTime<P>>;
+
+/**
+ * @class FixedTime
+ * @brief Time of day stored as a tick count since midnight
+ *
+ * @details
+ * Ticks are seconds, milliseconds or microseconds, held in the smallest
+ * unsigned type covering a day: 4 bytes for seconds and milliseconds,
+ * 8 bytes for microseconds. Unit conversions are compile-time constants.
+ *
+ * Converting to a finer precision (including Time) is lossless and
+ * implicit via to<Q>() / to_time(); going coarser requires floor().
+ *
+ * @tparam P std::chrono::seconds, milliseconds or microseconds
+ */
+template <typename P>
+class FixedTime {
+    static_assert(detail::time_precision<P> && !std::is_same_v<P, std::chrono::nanoseconds>,
+                  "Use Time for nanosecond precision");
+
+public:
+    using traits = detail::precision_traits<P>;
+    using rep = typename traits::rep;
+    using precision = P;
+
+private:
+    rep ticks_ = 0;   ///< Ticks since midnight
+
+public:
+    /**
+     * @brief Default constructor - creates midnight
+     */
+    constexpr FixedTime() noexcept = default;
+
+    /**
+     * @brief Construct from components
+     * @param sub Sub-second part in ticks (e.g. milliseconds for FixedTime<milliseconds>)
+     * @throw std::out_of_range if any component is invalid
+     */
+    constexpr FixedTime(int h, int min, int s = 0, int64_t sub = 0) {
+        if (!is_valid_hour(h) || !is_valid_minute(min) || !is_valid_second(s) || sub < 0 ||
+            sub >= traits::ticks_per_second) {
+            throw std::out_of_range("Invalid time components");
+        }
+        ticks_ = static_cast<rep>((int64_t{h} * detail::SECONDS_PER_HOUR + int64_t{min} * detail::SECONDS_PER_MINUTE + s) *
+                                      traits::ticks_per_second + sub);
+    }
+
+    /**
+     * @brief Construct from ticks since midnight
+     * @throw std::out_of_range if ticks is not below one day
+     */
+    constexpr explicit FixedTime(uint64_t ticks) {
+        if (ticks >= static_cast<uint64_t>(traits::ticks_per_day)) {
+            throw std::out_of_range("Ticks exceed one day");
+        }
+        ticks_ = static_cast<rep>(ticks);
+    }
+
+    /**
+     * @brief Construct from ticks since midnight already known to be in range (no checks)
+     */
+    constexpr FixedTime(unchecked_t, uint64_t ticks) noexcept : ticks_(static_cast<rep>(ticks)) {}
+
+    /**
+     * @brief Construct from components without throwing
+     */
+    [[nodiscard]] static constexpr std::optional<FixedTime> try_make(int h, int min, int s = 0, int64_t sub = 0) noexcept {
+        if (!is_valid_hour(h) || !is_valid_minute(min) || !is_valid_second(s) || sub < 0 ||
+            sub >= traits::ticks_per_second) {
+            return std::nullopt;
+        }
+        return FixedTime(unchecked, static_cast<uint64_t>(
+            (int64_t{h} * detail::SECONDS_PER_HOUR + int64_t{min} * detail::SECONDS_PER_MINUTE + s) * traits::ticks_per_second + sub));
+    }
+
+    /**
+     * @brief Truncate a Time (or finer FixedTime) to this precision
+     */
+    [[nodiscard]] static constexpr FixedTime floor(const Time& t) noexcept {
+        return FixedTime(unchecked, t.total_nanoseconds() / static_cast<uint64_t>(traits::nanos_per_tick));
+    }
+
+    // ========================================================================
+    // Accessors
+    // ========================================================================
+
+    [[nodiscard]] constexpr rep ticks() const noexcept { return ticks_; }
+    [[nodiscard]] constexpr int64_t total_seconds() const noexcept { return static_cast<int64_t>(ticks_) / traits::ticks_per_second; }
+    [[nodiscard]] constexpr uint64_t total_nanoseconds() const noexcept {
+        return static_cast<uint64_t>(ticks_) * static_cast<uint64_t>(traits::nanos_per_tick);
+    }
+
+    [[nodiscard]] constexpr int hour() const noexcept { return static_cast<int>(total_seconds() / detail::SECONDS_PER_HOUR); }
+    [[nodiscard]] constexpr int minute() const noexcept {
+        return static_cast<int>(total_seconds() / detail::SECONDS_PER_MINUTE % detail::MINUTES_PER_HOUR);
+    }
+    [[nodiscard]] constexpr int second() const noexcept { return static_cast<int>(total_seconds() % detail::SECONDS_PER_MINUTE); }
+
+    /// Sub-second part in ticks
+    [[nodiscard]] constexpr int64_t subsecond() const noexcept { return static_cast<int64_t>(ticks_) % traits::ticks_per_second; }
+    [[nodiscard]] constexpr int millisecond() const noexcept {
+        return static_cast<int>(subsecond() * 1000 / traits::ticks_per_second);
+    }
+    [[nodiscard]] constexpr int microsecond() const noexcept {
+        return static_cast<int>(subsecond() * 1'000'000 / traits::ticks_per_second);
+    }
+    [[nodiscard]] constexpr int nanosecond() const noexcept { return static_cast<int>(subsecond() * traits::nanos_per_tick); }
+
+    // ========================================================================
+    // Conversion
+    // ========================================================================
+
+    /**
+     * @brief Lossless conversion to the nanosecond Time
+     */
+    [[nodiscard]] constexpr Time to_time() const noexcept { return Time(unchecked, total_nanoseconds()); }
+    constexpr operator Time() const noexcept { return to_time(); }
+
+    /**
+     * @brief Lossless conversion to an equal or finer precision
+     */
+    template <detail::time_precision Q>
+    [[nodiscard]] constexpr BasicTime<Q> to() const noexcept {
+        static_assert(detail::precision_traits<Q>::ticks_per_second >= traits::ticks_per_second,
+                      "to<Q>() only converts toward finer precision; use floor()");
+        if constexpr (std::is_same_v<Q, std::chrono::nanoseconds>) {
+            return to_time();
+        } else {
+            constexpr uint64_t scale = detail::precision_traits<Q>::ticks_per_second / traits::ticks_per_second;
+            return BasicTime<Q>(unchecked, static_cast<uint64_t>(ticks_) * scale);
+        }
+    }
+
+    // ========================================================================
+    // Arithmetic Operations
+    // ========================================================================
+
+    /**
+     * @brief Add ticks, wrapping around midnight
+     */
+    constexpr FixedTime& add_ticks(int64_t ticks) noexcept {
+        int64_t t = (static_cast<int64_t>(ticks_) + ticks % traits::ticks_per_day) % traits::ticks_per_day;
+        if (t < 0) t += traits::ticks_per_day;
+        ticks_ = static_cast<rep>(t);
+        return *this;
+    }
+
+    constexpr FixedTime& add_seconds(int64_t seconds) noexcept {
+        return add_ticks(seconds % detail::SECONDS_PER_DAY * traits::ticks_per_second);
+    }
+    constexpr FixedTime& add_minutes(int64_t minutes) noexcept { return add_seconds(minutes % (24 * 60) * detail::SECONDS_PER_MINUTE); }
+    constexpr FixedTime& add_hours(int64_t hours) noexcept { return add_seconds(hours % 24 * detail::SECONDS_PER_HOUR); }
+
+    // ========================================================================
+    // Formatting
+    // ========================================================================
+
+    /**
+     * @brief Format time as string (same specifiers as Time::format)
+     * @param fmt Defaults to "%H:%M:%S" plus ".%f" or ".%u" for millisecond or microsecond precision
+     */
+    [[nodiscard]] std::string format(std::string_view fmt = traits::time_format) const { return to_time().format(fmt); }
+
+    // ========================================================================
+    // Comparison Operators
+    // ========================================================================
+
+    [[nodiscard]] constexpr auto operator<=>(const FixedTime&) const noexcept = default;
+};
+
+/**
+ * @class FixedDateTime
+ * @brief Timestamp stored as a signed 64-bit tick count since the Unix epoch
+ *
+ * @details
+ * Eight bytes for every precision (DateTime needs 16), and 0001..9999 fits
+ * at microsecond precision. Comparison and tick arithmetic are single
+ * integer operations; calendar fields are derived on access.
+ *
+ * @tparam P std::chrono::seconds, milliseconds or microseconds
+ */
+template <typename P>
+class FixedDateTime {
+    static_assert(detail::time_precision<P> && !std::is_same_v<P, std::chrono::nanoseconds>,
+                  "Use DateTime for nanosecond precision");
+
+public:
+    using traits = detail::precision_traits<P>;
+    using precision = P;
+
+private:
+    int64_t ticks_ = static_cast<int64_t>(detail::MIN_UNIX_DAYS) * traits::ticks_per_day;   ///< Ticks since 1970-01-01
+
+public:
+    /**
+     * @brief Default constructor - creates 0001-01-01 00:00:00
+     */
+    constexpr FixedDateTime() noexcept = default;
+
+    /**
+     * @brief Construct from Date and FixedTime components
+     */
+    constexpr FixedDateTime(const Date& d, const FixedTime<P>& t = FixedTime<P>()) noexcept
+        : ticks_(static_cast<int64_t>(d.to_unix_days()) * traits::ticks_per_day + static_cast<int64_t>(t.ticks())) {}
+
+    /**
+     * @brief Construct from separate components
+     * @param sub Sub-second part in ticks
+     * @throw std::out_of_range if any component is invalid
+     */
+    constexpr FixedDateTime(int year, int month, int day, int hour = 0, int minute = 0, int second = 0, int64_t sub = 0)
+        : FixedDateTime(Date(year, month, day), FixedTime<P>(hour, minute, second, sub)) {}
+
+    /**
+     * @brief Construct from ticks since the Unix epoch already known to be in range (no checks)
+     */
+    constexpr FixedDateTime(unchecked_t, int64_t ticks) noexcept : ticks_(ticks) {}
+
+    /**
+     * @brief Construct from separate components without throwing
+     */
+    [[nodiscard]] static constexpr std::optional<FixedDateTime> try_make(int year, int month, int day, int hour = 0,
+                                                                         int minute = 0, int second = 0,
+                                                                         int64_t sub = 0) noexcept {
+        auto d = Date::try_make(year, month, day);
+        auto t = FixedTime<P>::try_make(hour, minute, second, sub);
+        if (!d || !t) return std::nullopt;
+        return FixedDateTime(*d, *t);
+    }
+
+    /**
+     * @brief Create from ticks since the Unix epoch
+     * @throw std::out_of_range if the result is outside 0001-01-01 .. 9999-12-31
+     */
+    [[nodiscard]] static constexpr FixedDateTime from_ticks(int64_t ticks) {
+        int64_t days = detail::floor_div(ticks, traits::ticks_per_day);
+        if (days < detail::MIN_UNIX_DAYS || days > detail::MAX_UNIX_DAYS) {
+            throw std::out_of_range("Timestamp outside supported range");
+        }
+        return FixedDateTime(unchecked, ticks);
+    }
+
+    /**
+     * @brief Truncate a DateTime to this precision
+     */
+    [[nodiscard]] static constexpr FixedDateTime floor(const DateTime& dt) noexcept {
+        return FixedDateTime(dt.get_date(), FixedTime<P>::floor(dt.get_time()));
+    }
+
+    // ========================================================================
+    // Accessors
+    // ========================================================================
+
+    [[nodiscard]] constexpr int64_t ticks() const noexcept { return ticks_; }
+
+    [[nodiscard]] constexpr Date get_date() const noexcept {
+        return Date::from_unix_days(static_cast<int32_t>(detail::floor_div(ticks_, traits::ticks_per_day)));
+    }
+    [[nodiscard]] constexpr FixedTime<P> get_time() const noexcept {
+        int64_t t = ticks_ % traits::ticks_per_day;
+        return FixedTime<P>(unchecked, static_cast<uint64_t>(t < 0 ? t + traits::ticks_per_day : t));
+    }
+
+    [[nodiscard]] constexpr int year() const noexcept { return get_date().year(); }
+    [[nodiscard]] constexpr int month() const noexcept { return get_date().month(); }
+    [[nodiscard]] constexpr int day() const noexcept { return get_date().day(); }
+    [[nodiscard]] constexpr int hour() const noexcept { return get_time().hour(); }
+    [[nodiscard]] constexpr int minute() const noexcept { return get_time().minute(); }
+    [[nodiscard]] constexpr int second() const noexcept { return get_time().second(); }
+    [[nodiscard]] constexpr int millisecond() const noexcept { return get_time().millisecond(); }
+    [[nodiscard]] constexpr int microsecond() const noexcept { return get_time().microsecond(); }
+
+    // ========================================================================
+    // Conversion
+    // ========================================================================
+
+    /**
+     * @brief Lossless conversion to the nanosecond DateTime
+     */
+    [[nodiscard]] constexpr DateTime to_datetime() const noexcept { return DateTime(get_date(), get_time().to_time()); }
+    constexpr operator DateTime() const noexcept { return to_datetime(); }
+
+    /**
+     * @brief Lossless conversion to an equal or finer precision
+     */
+    template <detail::time_precision Q>
+    [[nodiscard]] constexpr BasicDateTime<Q> to() const noexcept {
+        static_assert(detail::precision_traits<Q>::ticks_per_second >= traits::ticks_per_second,
+                      "to<Q>() only converts toward finer precision; use floor()");
+        if constexpr (std::is_same_v<Q, std::chrono::nanoseconds>) {
+            return to_datetime();
+        } else {
+            constexpr int64_t scale = detail::precision_traits<Q>::ticks_per_second / traits::ticks_per_second;
+            return BasicDateTime<Q>(unchecked, ticks_ * scale);
+        }
+    }
+
+    [[nodiscard]] constexpr int64_t to_unix_timestamp() const noexcept {
+        return detail::floor_div(ticks_, traits::ticks_per_second);
+    }
+
+    /**
+     * @brief Convert to std::chrono::sys_time at this precision
+     */
+    [[nodiscard]] constexpr std::chrono::sys_time<P> to_sys_time() const noexcept {
+        return std::chrono::sys_time<P>(P(ticks_));
+    }
+
+    // ========================================================================
+    // Arithmetic Operations
+    // ========================================================================
+
+    /// Tick arithmetic does not range-check; keep results within 0001..9999
+    constexpr FixedDateTime& add_ticks(int64_t ticks) noexcept {
+        ticks_ += ticks;
+        return *this;
+    }
+    constexpr FixedDateTime& add_seconds(int64_t seconds) noexcept { return add_ticks(seconds * traits::ticks_per_second); }
+    constexpr FixedDateTime& add_minutes(int64_t minutes) noexcept { return add_seconds(minutes * detail::SECONDS_PER_MINUTE); }
+    constexpr FixedDateTime& add_hours(int64_t hours) noexcept { return add_seconds(hours * detail::SECONDS_PER_HOUR); }
+    constexpr FixedDateTime& add_days(int32_t days) noexcept { return add_ticks(int64_t{days} * traits::ticks_per_day); }
+
+    /**
+     * @brief Ticks from other to this
+     */
+    [[nodiscard]] constexpr int64_t ticks_between(const FixedDateTime& other) const noexcept { return ticks_ - other.ticks_; }
+
+    // ========================================================================
+    // Formatting
+    // ========================================================================
+
+    /**
+     * @brief Format as string (same specifiers as DateTime::format)
+     * @param fmt Defaults to "%Y-%m-%d %H:%M:%S" plus the fraction digits of the precision
+     */
+    [[nodiscard]] std::string format(std::string_view fmt = default_format()) const { return to_datetime().format(fmt); }
+
+    /**
+     * @brief ISO 8601 with as many fraction digits as the precision carries
+     */
+    [[nodiscard]] std::string to_iso8601() const {
+        if constexpr (traits::ticks_per_second == 1) return to_datetime().to_iso8601();
+        else if constexpr (traits::ticks_per_second == 1000) return to_datetime().to_iso8601_ms();
+        else return to_datetime().to_iso8601_us();
+    }
+
+    [[nodiscard]] static constexpr std::string_view default_format() noexcept {
+        if constexpr (traits::ticks_per_second == 1) return "%Y-%m-%d %H:%M:%S";
+        else if constexpr (traits::ticks_per_second == 1000) return "%Y-%m-%d %H:%M:%S.%f";
+        else return "%Y-%m-%d %H:%M:%S.%u";
+    }
+
+    // ========================================================================
+    // Comparison Operators
+    // ========================================================================
+
+    [[nodiscard]] constexpr auto operator<=>(const FixedDateTime&) const noexcept = default;
+};
+
+using TimeSeconds = BasicTime<std::chrono::seconds>;
+using TimeMillis = BasicTime<std::chrono::milliseconds>;
+using TimeMicros = BasicTime<std::chrono::microseconds>;
+using DateTimeSeconds = BasicDateTime<std::chrono::seconds>;
+using DateTimeMillis = BasicDateTime<std::chrono::milliseconds>;
+using DateTimeMicros = BasicDateTime<std::chrono::microseconds>;
+
+static_assert(sizeof(TimeMillis) == 4);
+static_assert(sizeof(DateTimeMillis) == 8);
+
+} // namespace zuu
+
+template <typename P>
+struct std::hash<zuu::FixedTime<P>> {
+    [[nodiscard]] constexpr size_t operator()(const zuu::FixedTime<P>& t) const noexcept {
+        return static_cast<size_t>(zuu::detail::hash_mix(t.ticks()));
+    }
+};
+
+template <typename P>
+struct std::hash<zuu::FixedDateTime<P>> {
+    [[nodiscard]] constexpr size_t operator()(const zuu::FixedDateTime<P>& dt) const noexcept {
+        return static_cast<size_t>(zuu::detail::hash_mix(static_cast<uint64_t>(dt.ticks())));
+    }
+};
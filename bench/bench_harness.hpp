@@ -0,0 +1,337 @@
+/**
+ * @file bench_harness.hpp
+ * @brief Minimal micro-benchmark harness with allocation counting and JSON output
+ *
+ * Exactly one translation unit must define ZUU_BENCH_COUNT_ALLOCATIONS before
+ * including this header; it then replaces global operator new/delete to
+ * count heap allocations made while a case runs.
+ *
+ * On Linux the harness can also read hardware counters (cycles, instructions,
+ * branch misses, cache misses) through perf_event_open. Counters the kernel
+ * or CPU does not provide are reported as null. The events are opened for
+ * the calling thread only (pid 0, no inherit), so a case that fans out
+ * through detail::parallel_chunks reports the counts of that one thread.
+ */
+
+#pragma once
+
+#include <algorithm>
+#include <array>
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+#include <cstdlib>
+#include <cstring>
+#include <new>
+#include <optional>
+#include <ostream>
+#include <string>
+#include <vector>
+
+#if defined(__linux__)
+    #define ZUU_BENCH_HAS_PERF 1
+    #include <linux/perf_event.h>
+    #include <sys/ioctl.h>
+    #include <sys/syscall.h>
+    #include <unistd.h>
+#else
+    #define ZUU_BENCH_HAS_PERF 0
+#endif
+
+namespace bench {
+
+/// Heap allocation counters (updated by the replaced operator new)
+inline std::atomic<uint64_t> alloc_count{0};
+inline std::atomic<uint64_t> alloc_bytes{0};
+
+/**
+ * @brief Keep a value alive so the optimiser cannot drop its computation
+ */
+template <typename T>
+inline void do_not_optimize(const T& value) {
+#if defined(__GNUC__) || defined(__clang__)
+    asm volatile("" : : "r,m"(value) : "memory");
+#else
+    static volatile const void* sink;
+    sink = &value;
+#endif
+}
+
+// ============================================================================
+// Hardware Counters
+// ============================================================================
+
+/**
+ * @class PerfCounters
+ * @brief User-space hardware counters of the calling thread
+ *
+ * Each event is opened on its own, so a missing one (common in VMs, or with
+ * a restrictive perf_event_paranoid) does not disable the others. Counts are
+ * scaled by time_enabled / time_running when the kernel multiplexes them.
+ * Threads spawned after start() are not counted (pid 0 without inherit).
+ */
+class PerfCounters {
+public:
+    enum Event { Cycles, Instructions, BranchMisses, CacheMisses, EVENT_COUNT };
+
+    static constexpr std::array<const char*, EVENT_COUNT> NAMES = {
+        "cycles", "instructions", "branch_misses", "cache_misses"};
+
+    using Counts = std::array<std::optional<double>, EVENT_COUNT>;
+
+private:
+    std::array<int, EVENT_COUNT> fds_;
+
+#if ZUU_BENCH_HAS_PERF
+    static int open_event(uint64_t config) noexcept {
+        perf_event_attr attr;
+        std::memset(&attr, 0, sizeof(attr));
+        attr.type = PERF_TYPE_HARDWARE;
+        attr.size = sizeof(attr);
+        attr.config = config;
+        attr.disabled = 1;
+        attr.exclude_kernel = 1;
+        attr.exclude_hv = 1;
+        attr.read_format = PERF_FORMAT_TOTAL_TIME_ENABLED | PERF_FORMAT_TOTAL_TIME_RUNNING;
+        return static_cast<int>(syscall(SYS_perf_event_open, &attr, 0, -1, -1, 0));
+    }
+#endif
+
+public:
+    PerfCounters() noexcept {
+        fds_.fill(-1);
+#if ZUU_BENCH_HAS_PERF
+        static constexpr std::array<uint64_t, EVENT_COUNT> CONFIGS = {
+            PERF_COUNT_HW_CPU_CYCLES, PERF_COUNT_HW_INSTRUCTIONS,
+            PERF_COUNT_HW_BRANCH_MISSES, PERF_COUNT_HW_CACHE_MISSES};
+        for (int e = 0; e < EVENT_COUNT; ++e) fds_[e] = open_event(CONFIGS[e]);
+#endif
+    }
+
+    ~PerfCounters() {
+#if ZUU_BENCH_HAS_PERF
+        for (int fd : fds_) {
+            if (fd >= 0) close(fd);
+        }
+#endif
+    }
+
+    PerfCounters(const PerfCounters&) = delete;
+    PerfCounters& operator=(const PerfCounters&) = delete;
+
+    /**
+     * @brief Check if at least one event could be opened
+     */
+    [[nodiscard]] bool any() const noexcept {
+        return std::any_of(fds_.begin(), fds_.end(), [](int fd) { return fd >= 0; });
+    }
+
+    /**
+     * @brief Reset and enable all open events
+     */
+    void start() noexcept {
+#if ZUU_BENCH_HAS_PERF
+        for (int fd : fds_) {
+            if (fd < 0) continue;
+            ioctl(fd, PERF_EVENT_IOC_RESET, 0);
+            ioctl(fd, PERF_EVENT_IOC_ENABLE, 0);
+        }
+#endif
+    }
+
+    /**
+     * @brief Disable all events and return their counts since start()
+     */
+    Counts stop() noexcept {
+        Counts counts;
+#if ZUU_BENCH_HAS_PERF
+        for (int fd : fds_) {
+            if (fd >= 0) ioctl(fd, PERF_EVENT_IOC_DISABLE, 0);
+        }
+        for (int e = 0; e < EVENT_COUNT; ++e) {
+            uint64_t buf[3] = {};   // value, time_enabled, time_running
+            if (fds_[e] < 0 || read(fds_[e], buf, sizeof(buf)) != static_cast<ssize_t>(sizeof(buf)) || buf[2] == 0) continue;
+            counts[e] = static_cast<double>(buf[0]) * static_cast<double>(buf[1]) / static_cast<double>(buf[2]);
+        }
+#endif
+        return counts;
+    }
+};
+
+// ============================================================================
+// Harness
+// ============================================================================
+
+/**
+ * @brief Measurements of one benchmark case
+ */
+struct Result {
+    std::string name;           ///< Operation, e.g. "Date::add_days"
+    std::string range;          ///< Input family, e.g. "realistic" or "adversarial"
+    uint64_t ops = 0;           ///< Operations timed in the best run
+    double ns_per_op = 0;
+    double ops_per_sec = 0;
+    double allocs_per_op = 0;
+    double bytes_per_op = 0;
+    PerfCounters::Counts per_op;   ///< Hardware counters per op (empty if unavailable)
+};
+
+/**
+ * @class Harness
+ * @brief Runs cases for a minimum time, keeps the fastest of several runs
+ */
+class Harness {
+private:
+    using Clock = std::chrono::steady_clock;
+
+    std::vector<Result> results_;
+    double min_time_s_;
+    int repetitions_;
+    std::string filter_;
+    std::optional<PerfCounters> perf_;
+
+    static void escape(std::ostream& os, const std::string& s) {
+        for (char c : s) {
+            if (c == '"' || c == '\\') os << '\\';
+            os << c;
+        }
+    }
+
+public:
+    /**
+     * @param min_time_s Minimum duration of each timed run
+     * @param repetitions Runs per case; the fastest is reported
+     * @param filter Only run cases whose name contains this text
+     * @param perf Also read hardware counters where the system allows it
+     */
+    explicit Harness(double min_time_s = 0.05, int repetitions = 3, std::string filter = {}, bool perf = false)
+        : min_time_s_(min_time_s), repetitions_(repetitions), filter_(std::move(filter)) {
+        if (perf) {
+            perf_.emplace();
+            if (!perf_->any()) perf_.reset();
+        }
+    }
+
+    /**
+     * @brief Check if hardware counters are being recorded
+     */
+    [[nodiscard]] bool has_perf() const noexcept { return perf_.has_value(); }
+
+    /**
+     * @brief Time fn(i) for i = 0, 1, 2, ... until min_time has elapsed
+     * @param name Operation name
+     * @param range Input family
+     * @param fn Callable performing one operation for index i
+     */
+    template <typename F>
+    void run(const std::string& name, const std::string& range, F&& fn) {
+        if (!filter_.empty() && name.find(filter_) == std::string::npos) return;
+
+        // Grow the batch until one batch takes a measurable time
+        uint64_t batch = 64;
+        for (;;) {
+            auto start = Clock::now();
+            for (uint64_t i = 0; i < batch; ++i) fn(i);
+            if (std::chrono::duration<double>(Clock::now() - start).count() > min_time_s_ / 10 || batch >= (1ull << 30)) break;
+            batch *= 4;
+        }
+
+        Result best;
+        best.name = name;
+        best.range = range;
+        best.ns_per_op = 1e300;
+        for (int r = 0; r < repetitions_; ++r) {
+            uint64_t ops = 0;
+            uint64_t allocs0 = alloc_count.load(std::memory_order_relaxed);
+            uint64_t bytes0 = alloc_bytes.load(std::memory_order_relaxed);
+            if (perf_) perf_->start();
+            auto start = Clock::now();
+            double elapsed = 0;
+            do {
+                for (uint64_t i = 0; i < batch; ++i) fn(ops + i);
+                ops += batch;
+                elapsed = std::chrono::duration<double>(Clock::now() - start).count();
+            } while (elapsed < min_time_s_);
+            PerfCounters::Counts counts;
+            if (perf_) counts = perf_->stop();
+            double ns = elapsed * 1e9 / static_cast<double>(ops);
+            if (ns < best.ns_per_op) {
+                best.ops = ops;
+                best.ns_per_op = ns;
+                best.ops_per_sec = 1e9 / ns;
+                best.allocs_per_op = static_cast<double>(alloc_count.load(std::memory_order_relaxed) - allocs0) / static_cast<double>(ops);
+                best.bytes_per_op = static_cast<double>(alloc_bytes.load(std::memory_order_relaxed) - bytes0) / static_cast<double>(ops);
+                for (size_t e = 0; e < counts.size(); ++e) {
+                    best.per_op[e] = counts[e] ? std::optional<double>(*counts[e] / static_cast<double>(ops)) : std::nullopt;
+                }
+            }
+        }
+        results_.push_back(best);
+    }
+
+    /**
+     * @brief Get all results so far
+     */
+    [[nodiscard]] const std::vector<Result>& results() const noexcept { return results_; }
+
+    /**
+     * @brief Write results as a JSON document
+     */
+    void write_json(std::ostream& os) const {
+        os << "{\n  \"perf_counters\": " << (perf_ ? "true" : "false") << ",\n  \"benchmarks\": [\n";
+        for (size_t i = 0; i < results_.size(); ++i) {
+            const Result& r = results_[i];
+            os << "    {\"name\": \"";
+            escape(os, r.name);
+            os << "\", \"range\": \"";
+            escape(os, r.range);
+            os << "\", \"ops\": " << r.ops
+               << ", \"ns_per_op\": " << r.ns_per_op
+               << ", \"ops_per_sec\": " << r.ops_per_sec
+               << ", \"allocs_per_op\": " << r.allocs_per_op
+               << ", \"alloc_bytes_per_op\": " << r.bytes_per_op;
+            if (perf_) {
+                for (size_t e = 0; e < r.per_op.size(); ++e) {
+                    os << ", \"" << PerfCounters::NAMES[e] << "_per_op\": ";
+                    if (r.per_op[e]) os << *r.per_op[e];
+                    else os << "null";
+                }
+            }
+            os << "}" << (i + 1 < results_.size() ? ",\n" : "\n");
+        }
+        os << "  ]\n}\n";
+    }
+
+    /**
+     * @brief Write a human-readable table
+     */
+    void write_text(std::ostream& os) const {
+        for (const Result& r : results_) {
+            os << r.name << " [" << r.range << "]: " << r.ns_per_op << " ns/op, "
+               << r.allocs_per_op << " allocs/op";
+            for (size_t e = 0; e < r.per_op.size(); ++e) {
+                if (r.per_op[e]) os << ", " << *r.per_op[e] << ' ' << PerfCounters::NAMES[e];
+            }
+            os << '\n';
+        }
+    }
+};
+
+} // namespace bench
+
+#if defined(ZUU_BENCH_COUNT_ALLOCATIONS)
+
+void* operator new(std::size_t size) {
+    bench::alloc_count.fetch_add(1, std::memory_order_relaxed);
+    bench::alloc_bytes.fetch_add(size, std::memory_order_relaxed);
+    if (void* p = std::malloc(size ? size : 1)) return p;
+    throw std::bad_alloc();
+}
+
+void* operator new[](std::size_t size) { return ::operator new(size); }
+void operator delete(void* p) noexcept { std::free(p); }
+void operator delete[](void* p) noexcept { std::free(p); }
+void operator delete(void* p, std::size_t) noexcept { std::free(p); }
+void operator delete[](void* p, std::size_t) noexcept { std::free(p); }
+
+#endif
@@ -0,0 +1,82 @@
+/**
+ * @file bench_interval_index.cpp
+ * @brief IntervalIndex stabbing/overlap queries versus a linear scan
+ *
+ * Usage: bench_interval_index [entries] [queries]
+ */
+
+#include "../datetime.hpp"
+#include "../interval_index.hpp"
+#include <chrono>
+#include <iostream>
+#include <random>
+
+namespace {
+
+using Clock = std::chrono::steady_clock;
+
+double elapsed_ns(Clock::time_point start) {
+    return std::chrono::duration<double, std::nano>(Clock::now() - start).count();
+}
+
+} // namespace
+
+int main(int argc, char** argv) {
+    size_t n = argc > 1 ? std::stoull(argv[1]) : 10'000'000;
+    size_t queries = argc > 2 ? std::stoull(argv[2]) : 100'000;
+
+    // Reservations over one year, 30 minutes to 1 day long
+    const int64_t year_start = zuu::DateTime(2024, 1, 1).to_unix_nanos();
+    const int64_t year_len = 366 * static_cast<int64_t>(zuu::detail::NANOS_PER_DAY);
+    std::mt19937_64 rng(42);
+    std::uniform_int_distribution<int64_t> pos(0, year_len);
+    std::uniform_int_distribution<int64_t> len(30 * static_cast<int64_t>(zuu::detail::NANOS_PER_MINUTE),
+                                               static_cast<int64_t>(zuu::detail::NANOS_PER_DAY));
+
+    std::vector<int64_t> starts(n), ends(n);
+    std::vector<uint32_t> ids(n);
+    for (size_t i = 0; i < n; ++i) {
+        starts[i] = year_start + pos(rng);
+        ends[i] = starts[i] + len(rng);
+        ids[i] = static_cast<uint32_t>(i);
+    }
+
+    auto t0 = Clock::now();
+    auto index = zuu::IntervalIndex<uint32_t, int64_t>::build(starts, ends, ids);
+    double build_ns = elapsed_ns(t0);
+
+    std::vector<int64_t> probes(queries);
+    for (auto& p : probes) p = year_start + pos(rng);
+
+    // Stabbing queries through the index
+    size_t hits_index = 0;
+    t0 = Clock::now();
+    for (int64_t p : probes) {
+        hits_index += index.count_overlaps(zuu::Interval<int64_t>(p, p + 1));
+    }
+    double index_ns = elapsed_ns(t0);
+
+    // Linear scan baseline (subset of queries; it is O(n) per query)
+    size_t scan_queries = std::min<size_t>(queries, 100);
+    size_t hits_scan = 0, hits_check = 0;
+    t0 = Clock::now();
+    for (size_t q = 0; q < scan_queries; ++q) {
+        int64_t p = probes[q];
+        for (size_t i = 0; i < n; ++i) {
+            hits_scan += (starts[i] <= p) & (p < ends[i]);
+        }
+    }
+    double scan_ns = elapsed_ns(t0);
+    for (size_t q = 0; q < scan_queries; ++q) {
+        hits_check += index.count_overlaps(zuu::Interval<int64_t>(probes[q], probes[q] + 1));
+    }
+
+    std::cout << "entries:            " << n << "\n"
+              << "bulk load:          " << build_ns / 1e6 << " ms\n"
+              << "index stab query:   " << index_ns / queries << " ns/query ("
+              << static_cast<double>(hits_index) / queries << " hits/query)\n"
+              << "linear scan query:  " << scan_ns / scan_queries << " ns/query\n"
+              << "speedup:            " << (scan_ns / scan_queries) / (index_ns / queries) << "x\n"
+              << "results match:      " << (hits_scan == hits_check ? "yes" : "NO") << std::endl;
+    return hits_scan == hits_check ? 0 : 1;
+}
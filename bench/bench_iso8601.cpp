@@ -0,0 +1,65 @@
+/**
+ * @file bench_iso8601.cpp
+ * @brief format_iso8601() versus per-row to_iso8601_ms()
+ *
+ * Usage: bench_iso8601 [rows]
+ */
+
+#include "../datetime.hpp"
+#include "../iso8601_batch.hpp"
+#include <algorithm>
+#include <chrono>
+#include <iostream>
+#include <random>
+#include <string>
+#include <vector>
+
+namespace {
+
+using Clock = std::chrono::steady_clock;
+
+template <typename F>
+double time_ms(F&& fn) {
+    auto start = Clock::now();
+    fn();
+    return std::chrono::duration<double, std::milli>(Clock::now() - start).count();
+}
+
+void report(const char* name, double ms, size_t rows, size_t bytes) {
+    std::cout << "  " << name << ms << " ms (" << ms * 1e6 / static_cast<double>(rows) << " ns/row, "
+              << static_cast<double>(bytes) / (ms * 1e-3) / 1e6 << " MB/s)\n";
+}
+
+} // namespace
+
+int main(int argc, char** argv) {
+    size_t n = argc > 1 ? std::stoull(argv[1]) : 10'000'000;
+
+    std::mt19937_64 rng(11);
+    std::vector<zuu::DateTime> values(n);
+    int32_t base = zuu::Date(2020, 1, 1).to_unix_days();
+    for (auto& v : values) {
+        v = zuu::DateTime(zuu::Date::from_unix_days(base + static_cast<int32_t>(rng() % 3650)),
+                          zuu::Time(rng() % zuu::detail::NANOS_PER_DAY));
+    }
+
+    std::cout << "ISO 8601 (ms) x " << n << " rows\n";
+    std::vector<char> buf(n * (zuu::iso8601_length(zuu::IsoPrecision::Milliseconds) + 1));
+    size_t bytes = 0;
+    double batch_ms = time_ms([&] { bytes = zuu::format_iso8601(values, buf.data(), '\n'); });
+    report("zuu::format_iso8601: ", batch_ms, n, bytes);
+
+    std::string text;
+    text.reserve(buf.size());
+    double row_ms = time_ms([&] {
+        for (const auto& v : values) {
+            text += v.to_iso8601_ms();
+            text += '\n';
+        }
+    });
+    report("to_iso8601_ms():     ", row_ms, n, text.size());
+
+    bool same = text.size() == bytes && std::equal(text.begin(), text.end(), buf.begin());
+    std::cout << "  output " << (same ? "identical" : "DIFFERS") << ", speedup " << row_ms / batch_ms << "x\n";
+    return same ? 0 : 1;
+}
@@ -0,0 +1,84 @@
+/**
+ * @file bench_radix_sort.cpp
+ * @brief radix_sort() versus std::sort and std::sort(std::execution::par)
+ *
+ * Usage: bench_radix_sort [elements]
+ */
+
+#include "../datetime.hpp"
+#include "../datetime_sort.hpp"
+#include <algorithm>
+#include <chrono>
+#include <iostream>
+#include <random>
+#include <version>
+#if defined(__cpp_lib_execution)
+#include <execution>
+#endif
+
+namespace {
+
+using Clock = std::chrono::steady_clock;
+
+template <typename F>
+double time_ms(F&& fn) {
+    auto start = Clock::now();
+    fn();
+    return std::chrono::duration<double, std::milli>(Clock::now() - start).count();
+}
+
+void report(const char* name, double ms, size_t n, bool ok) {
+    std::cout << "  " << name << ms << " ms (" << ms * 1e6 / static_cast<double>(n) << " ns/elem)"
+              << (ok ? "" : "  [WRONG ORDER]") << "\n";
+}
+
+/// One day of events, or events spread over ten years
+std::vector<zuu::DateTime> make_events(size_t n, int32_t day_spread, uint64_t seed) {
+    std::mt19937_64 rng(seed);
+    std::vector<zuu::DateTime> v(n);
+    int32_t base = zuu::Date(2024, 3, 15).to_unix_days();
+    for (auto& x : v) {
+        int32_t day = base + static_cast<int32_t>(rng() % static_cast<uint64_t>(day_spread));
+        x = zuu::DateTime(zuu::Date::from_unix_days(day), zuu::Time(rng() % zuu::detail::NANOS_PER_DAY));
+    }
+    return v;
+}
+
+} // namespace
+
+int main(int argc, char** argv) {
+    size_t n = argc > 1 ? std::stoull(argv[1]) : 20'000'000;
+
+    for (int32_t spread : {1, 3650}) {
+        std::cout << "DateTime x " << n << ", spread " << spread << " day(s)\n";
+        auto input = make_events(n, spread, 7);
+
+        auto a = input;
+        double radix_ms = time_ms([&] { zuu::radix_sort(std::span<zuu::DateTime>(a)); });
+        report("zuu::radix_sort:     ", radix_ms, n, std::is_sorted(a.begin(), a.end()));
+
+        auto b = input;
+        double sort_ms = time_ms([&] { std::sort(b.begin(), b.end()); });
+        report("std::sort:           ", sort_ms, n, std::is_sorted(b.begin(), b.end()));
+
+#if defined(__cpp_lib_execution)
+        auto c = input;
+        double par_ms = time_ms([&] { std::sort(std::execution::par, c.begin(), c.end()); });
+        report("std::sort(par):      ", par_ms, n, std::is_sorted(c.begin(), c.end()));
+#endif
+        std::cout << "  speedup vs std::sort: " << sort_ms / radix_ms << "x\n";
+    }
+
+    std::cout << "int64 epoch nanoseconds x " << n << "\n";
+    std::vector<int64_t> nanos(n);
+    std::mt19937_64 rng(9);
+    int64_t day0 = zuu::DateTime(2024, 3, 15).to_unix_nanos();
+    for (auto& x : nanos) x = day0 + static_cast<int64_t>(rng() % zuu::detail::NANOS_PER_DAY);
+    auto d = nanos;
+    double radix_ms = time_ms([&] { zuu::radix_sort(std::span<int64_t>(d)); });
+    report("zuu::radix_sort:     ", radix_ms, n, std::is_sorted(d.begin(), d.end()));
+    auto e = nanos;
+    double sort_ms = time_ms([&] { std::sort(e.begin(), e.end()); });
+    report("std::sort:           ", sort_ms, n, std::is_sorted(e.begin(), e.end()));
+    return 0;
+}
@@ -0,0 +1,74 @@
+/**
+ * @file bench_timestamp_stats.cpp
+ * @brief timestamp_stats() and QuantileSketch versus a plain summing pass
+ *
+ * Usage: bench_timestamp_stats [rows] [passes]
+ *
+ * Processes rows * passes values in total (default 1e8 x 10 = 1e9). The
+ * plain sum is the memory-bandwidth baseline; timestamp_stats() should be
+ * close to it. Configure with -DCMAKE_CXX_FLAGS=-march=native to enable
+ * the AVX2 kernel.
+ */
+
+#include "bench_harness.hpp"
+
+#include "../timestamp_stats.hpp"
+#include <chrono>
+#include <iostream>
+#include <numeric>
+#include <random>
+#include <string>
+#include <vector>
+
+namespace {
+
+using Clock = std::chrono::steady_clock;
+
+template <typename F>
+double time_ms(size_t passes, F&& fn) {
+    auto start = Clock::now();
+    for (size_t p = 0; p < passes; ++p) fn();
+    return std::chrono::duration<double, std::milli>(Clock::now() - start).count();
+}
+
+void report(const char* name, double ms, size_t values) {
+    std::cout << "  " << name << ms << " ms (" << ms * 1e6 / static_cast<double>(values) << " ns/value, "
+              << static_cast<double>(values * sizeof(int64_t)) / (ms * 1e-3) / 1e9 << " GB/s)\n";
+}
+
+} // namespace
+
+int main(int argc, char** argv) {
+    size_t n = argc > 1 ? std::stoull(argv[1]) : 100'000'000;
+    size_t passes = argc > 2 ? std::stoull(argv[2]) : 10;
+
+    // Arrival times about 1 ms apart with jitter, so a few percent are out of order
+    std::mt19937_64 rng(5);
+    std::vector<int64_t> stamps(n);
+    int64_t t = zuu::DateTime(2024, 1, 1).to_unix_nanos();
+    for (auto& s : stamps) {
+        t += 1'000'000;
+        s = t + static_cast<int64_t>(rng() % 4'000'000) - 2'000'000;
+    }
+
+    std::cout << "Timestamp statistics x " << n << " rows x " << passes << " passes (AVX2 "
+              << (ZUU_HAS_AVX2 ? "on" : "off") << ")\n";
+
+    double sum_ms = time_ms(passes, [&] {
+        bench::do_not_optimize(std::accumulate(stamps.begin(), stamps.end(), int64_t{0}));
+    });
+    report("plain sum:         ", sum_ms, n * passes);
+
+    zuu::TimestampStats stats;
+    double stats_ms = time_ms(passes, [&] { stats = zuu::timestamp_stats(stamps); });
+    report("timestamp_stats(): ", stats_ms, n * passes);
+
+    zuu::QuantileSketch<> sketch;
+    double sketch_ms = time_ms(1, [&] { sketch.add(stamps); });
+    report("QuantileSketch:    ", sketch_ms, n);
+
+    std::cout << "  min " << stats.min.to_iso8601_ms() << ", max " << stats.max.to_iso8601_ms()
+              << ", mean gap " << stats.mean_interarrival.total_nanoseconds() << " ns, out of order "
+              << stats.out_of_order << ", p50 " << sketch.quantile_datetime(0.5).to_iso8601_ms() << "\n";
+    return 0;
+}
@@ -0,0 +1,218 @@
+/**
+ * @file datetime_bench.cpp
+ * @brief Micro-benchmarks of the core Date/Time/DateTime operations
+ *
+ * Usage: datetime_bench [--out FILE] [--min-time SECONDS] [--filter TEXT] [--perf]
+ *
+ * Writes a JSON report (ns/op, ops/s, heap allocations per op) to stdout, or
+ * to FILE with a text summary on stdout. --perf adds cycles, instructions,
+ * branch misses and cache misses per op where perf_event_open is permitted.
+ *
+ * Every operation runs on a "realistic" input set (recent dates, small
+ * offsets) and an "adversarial" one (the full 0001..9999 range, large
+ * offsets, month and year edges).
+ */
+
+#define ZUU_BENCH_COUNT_ALLOCATIONS
+#include "bench_harness.hpp"
+
+#include "../datetime.hpp"
+#include "../rounding.hpp"
+#include <fstream>
+#include <iostream>
+#include <random>
+#include <string>
+#include <vector>
+
+namespace {
+
+constexpr size_t INPUTS = 4096;   // power of two: index with i & (INPUTS - 1)
+constexpr size_t MASK = INPUTS - 1;
+
+struct Inputs {
+    std::vector<zuu::Date> dates;
+    std::vector<zuu::DateTime> datetimes;
+    std::vector<int32_t> day_offsets;
+    std::vector<int32_t> month_offsets;
+    std::vector<int64_t> second_offsets;
+    std::vector<int64_t> timestamps;
+    std::vector<zuu::Date> partners;   ///< Second operand of days_between
+    std::vector<std::string> text;     ///< datetimes in the default format
+};
+
+zuu::Date random_date(std::mt19937_64& rng, int y0, int y1) {
+    int y = y0 + static_cast<int>(rng() % static_cast<uint64_t>(y1 - y0 + 1));
+    int m = 1 + static_cast<int>(rng() % 12);
+    int d = 1 + static_cast<int>(rng() % static_cast<uint64_t>(zuu::days_in_month(m, y)));
+    return zuu::Date(y, m, d);
+}
+
+/// Recent dates, offsets of days to weeks
+Inputs realistic(uint64_t seed) {
+    std::mt19937_64 rng(seed);
+    Inputs in;
+    for (size_t i = 0; i < INPUTS; ++i) {
+        zuu::Date d = random_date(rng, 2000, 2040);
+        in.dates.push_back(d);
+        in.datetimes.emplace_back(d, zuu::Time(rng() % zuu::detail::NANOS_PER_DAY));
+        in.day_offsets.push_back(static_cast<int32_t>(rng() % 61) - 30);
+        in.month_offsets.push_back(static_cast<int32_t>(rng() % 25) - 12);
+        in.second_offsets.push_back(static_cast<int64_t>(rng() % 172801) - 86400);
+        in.timestamps.push_back(946684800 + static_cast<int64_t>(rng() % (40ull * 365 * 86400)));
+        in.partners.push_back(random_date(rng, 2000, 2040));
+        in.text.push_back(in.datetimes.back().format());
+    }
+    return in;
+}
+
+/// Whole supported range, month/year edges, large offsets that stay in range
+Inputs adversarial(uint64_t seed) {
+    std::mt19937_64 rng(seed);
+    Inputs in;
+    for (size_t i = 0; i < INPUTS; ++i) {
+        zuu::Date d;
+        // Year and ISO-week edges stay within 0002..9998 so week_number() never
+        // has to look at a neighbouring year outside the supported range
+        int y = 2 + static_cast<int>(rng() % 9997);
+        switch (i % 4) {
+            case 0: d = random_date(rng, 1, 9999); break;
+            case 1: d = zuu::Date(y, 12, 31); break;                                        // year end
+            case 2: d = zuu::Date(y, 2, zuu::is_leap_year(y) ? 29 : 28); break;            // end of February
+            default: d = zuu::Date(y, 1, 1 + static_cast<int>(rng() % 4)); break;          // ISO week edge
+        }
+        in.dates.push_back(d);
+        in.datetimes.emplace_back(d, zuu::Time(zuu::detail::NANOS_PER_DAY - 1 - rng() % 1000));
+        // Keep results inside 0001..9999 so the operations do not just clamp
+        int32_t room_fwd = zuu::Date(9999, 12, 31).days_between(d);
+        int32_t room_back = d.days_between(zuu::Date(1, 1, 1));
+        in.day_offsets.push_back(rng() % 2 ? static_cast<int32_t>(rng() % static_cast<uint64_t>(room_fwd + 1))
+                                           : -static_cast<int32_t>(rng() % static_cast<uint64_t>(room_back + 1)));
+        in.month_offsets.push_back(static_cast<int32_t>(rng() % 24001) - 12000);
+        in.second_offsets.push_back(static_cast<int64_t>(in.day_offsets.back()) * 86400 +
+                                    static_cast<int64_t>(rng() % 86400));
+        in.timestamps.push_back(-62135596800 + static_cast<int64_t>(rng() % 315537897600ull));
+        in.partners.push_back(random_date(rng, 1, 9999));
+        in.text.push_back(in.datetimes.back().format());
+    }
+    return in;
+}
+
+void run_suite(bench::Harness& h, const Inputs& in, const std::string& range) {
+    using namespace zuu;
+
+    h.run("Date::Date(y,m,d)", range, [&](uint64_t i) {
+        const Date& d = in.dates[i & MASK];
+        bench::do_not_optimize(Date(d.year(), d.month(), d.day()));
+    });
+    h.run("DateTime::DateTime(y,m,d,h,m,s,ns)", range, [&](uint64_t i) {
+        const DateTime& d = in.datetimes[i & MASK];
+        bench::do_not_optimize(DateTime(d.year(), d.month(), d.day(), d.hour(), d.minute(), d.second(), d.nanosecond()));
+    });
+    h.run("Date::add_days", range, [&](uint64_t i) {
+        Date d = in.dates[i & MASK];
+        bench::do_not_optimize(d.add_days(in.day_offsets[i & MASK]));
+    });
+    h.run("Date::add_months", range, [&](uint64_t i) {
+        Date d = in.dates[i & MASK];
+        bench::do_not_optimize(d.add_months(in.month_offsets[i & MASK]));
+    });
+    h.run("Date::add_years", range, [&](uint64_t i) {
+        Date d = in.dates[i & MASK];
+        bench::do_not_optimize(d.add_years(in.month_offsets[i & MASK] / 12));
+    });
+    h.run("DateTime::add_seconds", range, [&](uint64_t i) {
+        DateTime d = in.datetimes[i & MASK];
+        bench::do_not_optimize(d.add_seconds(in.second_offsets[i & MASK]));
+    });
+    h.run("DateTime::add_nanoseconds", range, [&](uint64_t i) {
+        DateTime d = in.datetimes[i & MASK];
+        bench::do_not_optimize(d.add_nanoseconds(in.second_offsets[i & MASK] % 9'000'000'000 * 1'000'000'000));
+    });
+    h.run("Date::days_between", range, [&](uint64_t i) {
+        bench::do_not_optimize(in.dates[i & MASK].days_between(in.partners[i & MASK]));
+    });
+    h.run("Date::day_of_week", range, [&](uint64_t i) {
+        bench::do_not_optimize(in.dates[i & MASK].day_of_week());
+    });
+    h.run("Date::week_number", range, [&](uint64_t i) {
+        bench::do_not_optimize(in.dates[i & MASK].week_number());
+    });
+    h.run("Date::day_of_year", range, [&](uint64_t i) {
+        bench::do_not_optimize(in.dates[i & MASK].day_of_year());
+    });
+    h.run("Date::operator<=>", range, [&](uint64_t i) {
+        bench::do_not_optimize(in.dates[i & MASK] < in.partners[i & MASK]);
+    });
+    h.run("DateTime::operator<=>", range, [&](uint64_t i) {
+        bench::do_not_optimize(in.datetimes[i & MASK] < in.datetimes[(i + 1) & MASK]);
+    });
+    h.run("std::hash<Date>", range, [&](uint64_t i) {
+        bench::do_not_optimize(std::hash<Date>{}(in.dates[i & MASK]));
+    });
+    h.run("std::hash<DateTime>", range, [&](uint64_t i) {
+        bench::do_not_optimize(std::hash<DateTime>{}(in.datetimes[i & MASK]));
+    });
+    h.run("floor(DateTime, 5min)", range, [&](uint64_t i) {
+        bench::do_not_optimize(floor(in.datetimes[i & MASK], Duration::from_minutes(5)));
+    });
+    h.run("round(DateTime, Month)", range, [&](uint64_t i) {
+        bench::do_not_optimize(round(in.datetimes[i & MASK], CalendarUnit::Month));
+    });
+    h.run("DateTime::format(default)", range, [&](uint64_t i) {
+        bench::do_not_optimize(in.datetimes[i & MASK].format());
+    });
+    h.run("DateTime::format(names)", range, [&](uint64_t i) {
+        bench::do_not_optimize(in.datetimes[i & MASK].format("%A, %B %d, %Y %H:%M:%S.%N"));
+    });
+    h.run("DateTime::to_iso8601_ms", range, [&](uint64_t i) {
+        bench::do_not_optimize(in.datetimes[i & MASK].to_iso8601_ms());
+    });
+    h.run("DateTime::to_unix_timestamp", range, [&](uint64_t i) {
+        bench::do_not_optimize(in.datetimes[i & MASK].to_unix_timestamp());
+    });
+    h.run("DateTime::from_unix_timestamp", range, [&](uint64_t i) {
+        bench::do_not_optimize(DateTime::from_unix_timestamp(in.timestamps[i & MASK]));
+    });
+    h.run("DateTime::parse", range, [&](uint64_t i) {
+        bench::do_not_optimize(DateTime::try_parse(in.text[i & MASK]));
+    });
+}
+
+} // namespace
+
+int main(int argc, char** argv) {
+    std::string out_path, filter;
+    double min_time = 0.05;
+    bool perf = false;
+    for (int i = 1; i < argc; ++i) {
+        std::string arg = argv[i];
+        if (arg == "--out" && i + 1 < argc) {
+            out_path = argv[++i];
+        } else if (arg == "--min-time" && i + 1 < argc) {
+            min_time = std::stod(argv[++i]);
+        } else if (arg == "--filter" && i + 1 < argc) {
+            filter = argv[++i];
+        } else if (arg == "--perf") {
+            perf = true;
+        } else {
+            std::cerr << "usage: " << argv[0] << " [--out FILE] [--min-time SECONDS] [--filter TEXT] [--perf]\n";
+            return 2;
+        }
+    }
+
+    bench::Harness h(min_time, 3, filter, perf);
+    if (perf && !h.has_perf()) {
+        std::cerr << "note: hardware counters unavailable (see /proc/sys/kernel/perf_event_paranoid)\n";
+    }
+    run_suite(h, realistic(1), "realistic");
+    run_suite(h, adversarial(2), "adversarial");
+
+    if (out_path.empty()) {
+        h.write_json(std::cout);
+    } else {
+        std::ofstream out(out_path);
+        h.write_json(out);
+        h.write_text(std::cout);
+    }
+    return 0;
+}
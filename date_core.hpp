@@ -10,8 +10,10 @@
 
 #include "datetime_config.hpp"
 #include <chrono>
+#include <optional>
 #include <string_view>
 #include <compare>
+#include <functional>
 
 namespace zuu {
 
@@ -27,7 +29,7 @@ namespace zuu {
  * - Year range: 1-9999
  * - Automatic leap year handling
  * - Constexpr support
- * - Day-of-week calculation (Zeller's congruence)
+ * - Constant-time day-of-week, ISO week and day arithmetic
  * - Day-of-year calculation
  */
 class Date {
@@ -57,6 +59,22 @@ public:
         month_ = static_cast<uint8_t>(m);
         day_ = static_cast<uint8_t>(d);
     }
+    
+    /**
+     * @brief Construct from components already known to be valid (no checks)
+     * @pre is_valid_date(y, m, d)
+     */
+    constexpr Date(unchecked_t, int y, int m, int d) noexcept
+        : year_(static_cast<uint16_t>(y)), month_(static_cast<uint8_t>(m)), day_(static_cast<uint8_t>(d)) {}
+    
+    /**
+     * @brief Construct from year, month, day without throwing
+     * @return Date, or std::nullopt if the date is invalid
+     */
+    [[nodiscard]] static constexpr std::optional<Date> try_make(int y, int m, int d) noexcept {
+        if (!is_valid_date(y, m, d)) return std::nullopt;
+        return Date(unchecked, y, m, d);
+    }
 
     // ========================================================================
     // Component Accessors
@@ -85,20 +103,12 @@ public:
     // ========================================================================
     
     /**
-     * @brief Get day of week using Zeller's congruence
+     * @brief Get day of week from the serial day number
      * @return Day of week: 0=Monday, 1=Tuesday, ..., 6=Sunday
      */
     [[nodiscard]] constexpr int day_of_week() const noexcept {
-        int y = year_, m = month_;
-        if (m < 3) {
-            m += 12;
-            y--;
-        }
-        int q = day_;
-        int k = y % 100;
-        int j = y / 100;
-        int h = (q + (13 * (m + 1)) / 5 + k + k / 4 + j / 4 - 2 * j) % 7;
-        return (h + 6) % 7;  // Convert to Monday=0 format
+        // 0001-01-01 was a Monday, so the offset from it is never negative
+        return static_cast<int>(static_cast<uint32_t>(to_unix_days() - detail::MIN_UNIX_DAYS) % 7);
     }
     
     /**
@@ -118,35 +128,24 @@ public:
      * @return Week number [1-53]
      */
     [[nodiscard]] constexpr int week_number() const noexcept {
-        // ISO 8601: Week 1 is first week with Thursday
-        Date jan1(year_, 1, 1);
-        int dow_jan1 = jan1.day_of_week();
-        int doy = day_of_year();
-        
-        // Adjust for starting Monday
-        int week = (doy + dow_jan1 - 1) / 7;
-        
-        if (dow_jan1 <= 3) {  // Thursday or earlier
-            week++;
-        }
-        
-        if (week == 0) {
-            // Belongs to last week of previous year
-            Date last_year(year_ - 1, 12, 31);
-            return last_year.week_number();
-        }
-        
-        if (week == 53) {
-            // Check if it belongs to week 1 of next year
-            Date next_jan1(year_ + 1, 1, 1);
-            int dow_next_jan1 = next_jan1.day_of_week();
-            if (dow_next_jan1 <= 3) {
-                return 1;
-            }
-        }
-        
+        // ISO 8601: week 1 is the week containing the year's first Thursday
+        int week = (day_of_year() - day_of_week() + 9) / 7;
+        if (week < 1) return iso_weeks_in_year(year_ - 1);
+        if (week > iso_weeks_in_year(year_)) return 1;
         return week;
     }
+
+    /**
+     * @brief Get the number of ISO 8601 weeks in a year
+     * @param year Year [1-9999]
+     * @return 52 or 53
+     */
+    [[nodiscard]] static constexpr int iso_weeks_in_year(int year) noexcept {
+        // A year has 53 weeks if it starts on a Thursday, or on a Wednesday in a leap year;
+        // equivalently, if Dec 31 is a Thursday or Dec 31 of the year before is a Wednesday
+        auto dec31 = [](int y) { return (y + y / 4 - y / 100 + y / 400) % 7; };  // 0=Sunday
+        return dec31(year) == 4 || dec31(year - 1) == 3 ? 53 : 52;
+    }
     
     /**
      * @brief Get quarter of year
@@ -176,7 +175,7 @@ public:
         auto now = std::chrono::system_clock::now();
         auto time_t_now = std::chrono::system_clock::to_time_t(now);
         std::tm* tm_info = std::localtime(&time_t_now);
-        return Date(tm_info->tm_year + 1900, tm_info->tm_mon + 1, tm_info->tm_mday);
+        return Date(unchecked, tm_info->tm_year + 1900, tm_info->tm_mon + 1, tm_info->tm_mday);
     }
     
     /**
@@ -190,7 +189,6 @@ public:
             return Date();
         }
         
-        bool leap = zuu::is_leap_year(year);
         int month = 1;
         int remaining = day_of_year;
         
@@ -203,7 +201,20 @@ public:
             remaining -= days;
         }
         
-        return Date(year, month, remaining);
+        return Date(unchecked, year, month, remaining);
+    }
+    
+    /**
+     * @brief Create Date from days since the Unix epoch (1970-01-01)
+     * @param days Serial day number
+     * @return Date object, or 0001-01-01 if out of range
+     */
+    [[nodiscard]] static constexpr Date from_unix_days(int32_t days) noexcept {
+        if (days < detail::MIN_UNIX_DAYS || days > detail::MAX_UNIX_DAYS) {
+            return Date();
+        }
+        CivilDate c = civil_from_days(days);
+        return Date(unchecked, c.year, c.month, c.day);
     }
 
     // ========================================================================
@@ -218,32 +229,31 @@ public:
     constexpr Date& add_days(int32_t days) noexcept {
         if (days == 0) return *this;
         
-        int y = year_;
-        int m = month_;
-        int d = day_ + days;
-        
-        // Handle positive days
-        while (d > days_in_month(m, y)) {
-            d -= days_in_month(m, y);
-            if (++m > 12) {
-                m = 1;
-                y++;
+        // Small offsets cross at most one month boundary
+        if (days >= -28 && days <= 28) {
+            int y = year_, m = month_, d = day_ + days;
+            if (d > days_in_month(m, y)) {
+                d -= days_in_month(m, y);
+                if (++m > 12) { m = 1; ++y; }
+            } else if (d < 1) {
+                if (--m < 1) { m = 12; --y; }
+                d += days_in_month(m, y);
             }
-        }
-        
-        // Handle negative days
-        while (d < 1) {
-            if (--m < 1) {
-                m = 12;
-                y--;
+            if (y >= detail::MIN_YEAR && y <= detail::MAX_YEAR) {
+                year_ = static_cast<uint16_t>(y);
+                month_ = static_cast<uint8_t>(m);
+                day_ = static_cast<uint8_t>(d);
             }
-            d += days_in_month(m, y);
+            return *this;
         }
         
-        if (is_valid_date(y, m, d)) {
-            year_ = static_cast<uint16_t>(y);
-            month_ = static_cast<uint8_t>(m);
-            day_ = static_cast<uint8_t>(d);
+        // Constant time via the serial day number; results outside 1-9999 leave the date unchanged
+        int64_t serial = static_cast<int64_t>(to_unix_days()) + days;
+        if (serial >= detail::MIN_UNIX_DAYS && serial <= detail::MAX_UNIX_DAYS) {
+            CivilDate c = civil_from_days(static_cast<int32_t>(serial));
+            year_ = static_cast<uint16_t>(c.year);
+            month_ = static_cast<uint8_t>(c.month);
+            day_ = static_cast<uint8_t>(c.day);
         }
         
         return *this;
@@ -299,6 +309,60 @@ public:
         int32_t days2 = days_since_epoch(other.year_) + other.day_of_year() - 1;
         return days1 - days2;
     }
+    
+    /**
+     * @brief Get days since the Unix epoch (1970-01-01)
+     * @return Serial day number (negative before 1970)
+     */
+    [[nodiscard]] constexpr int32_t to_unix_days() const noexcept {
+        return days_from_civil(year_, month_, day_);
+    }
+
+    // ========================================================================
+    // std::chrono Interop
+    // ========================================================================
+    
+    /**
+     * @brief Convert to std::chrono::sys_days
+     * @return Day-precision time point (constant time)
+     */
+    [[nodiscard]] constexpr std::chrono::sys_days to_sys_days() const noexcept {
+        return std::chrono::sys_days(std::chrono::days(to_unix_days()));
+    }
+    
+    /**
+     * @brief Create Date from std::chrono::sys_days
+     * @param d Day-precision time point
+     * @return Date object, or 0001-01-01 if out of range
+     */
+    [[nodiscard]] static constexpr Date from_sys_days(std::chrono::sys_days d) noexcept {
+        auto count = d.time_since_epoch().count();
+        if (count < detail::MIN_UNIX_DAYS || count > detail::MAX_UNIX_DAYS) {
+            return Date();
+        }
+        return from_unix_days(static_cast<int32_t>(count));
+    }
+    
+    /**
+     * @brief Convert to std::chrono::year_month_day
+     */
+    [[nodiscard]] constexpr std::chrono::year_month_day to_year_month_day() const noexcept {
+        return std::chrono::year_month_day(std::chrono::year(year_),
+                                           std::chrono::month(month_),
+                                           std::chrono::day(day_));
+    }
+    
+    /**
+     * @brief Create Date from std::chrono::year_month_day
+     * @param ymd Calendar date
+     * @return Date object
+     * @throw std::out_of_range if ymd is invalid or outside 1-9999
+     */
+    [[nodiscard]] static constexpr Date from_year_month_day(const std::chrono::year_month_day& ymd) {
+        return Date(static_cast<int>(ymd.year()),
+                    static_cast<int>(static_cast<unsigned>(ymd.month())),
+                    static_cast<int>(static_cast<unsigned>(ymd.day())));
+    }
 
     // ========================================================================
     // Formatting
@@ -363,20 +427,35 @@ public:
     // Comparison Operators
     // ========================================================================
     
+    /**
+     * @brief Get the date as one order-preserving word (year << 16 | month << 8 | day)
+     * @details a < b exactly when a.packed() < b.packed(); usable as a sort or hash key
+     */
+    [[nodiscard]] constexpr uint32_t packed() const noexcept {
+        return static_cast<uint32_t>(year_) << 16 | static_cast<uint32_t>(month_) << 8 | day_;
+    }
+    
+    /**
+     * @brief Rebuild a Date from packed()
+     * @pre value came from packed() of a valid Date
+     */
+    [[nodiscard]] static constexpr Date from_packed(uint32_t value) noexcept {
+        return Date(unchecked, static_cast<int>(value >> 16), static_cast<int>((value >> 8) & 0xff),
+                    static_cast<int>(value & 0xff));
+    }
+    
     /**
      * @brief Three-way comparison (C++20 spaceship operator)
      */
     [[nodiscard]] constexpr std::strong_ordering operator<=>(const Date& other) const noexcept {
-        if (auto cmp = year_ <=> other.year_; cmp != 0) return cmp;
-        if (auto cmp = month_ <=> other.month_; cmp != 0) return cmp;
-        return day_ <=> other.day_;
+        return packed() <=> other.packed();
     }
     
     /**
      * @brief Equality comparison
      */
     [[nodiscard]] constexpr bool operator==(const Date& other) const noexcept {
-        return year_ == other.year_ && month_ == other.month_ && day_ == other.day_;
+        return packed() == other.packed();
     }
 
     // ========================================================================
@@ -405,7 +484,7 @@ public:
      * @return Date representing first day of this month
      */
     [[nodiscard]] constexpr Date first_day_of_month() const noexcept {
-        return Date(year_, month_, 1);
+        return Date(unchecked, year_, month_, 1);
     }
     
     /**
@@ -413,7 +492,7 @@ public:
      * @return Date representing last day of this month
      */
     [[nodiscard]] constexpr Date last_day_of_month() const noexcept {
-        return Date(year_, month_, days_in_month(month_, year_));
+        return Date(unchecked, year_, month_, days_in_month(month_, year_));
     }
     
     /**
@@ -421,7 +500,7 @@ public:
      * @return Date representing January 1 of this year
      */
     [[nodiscard]] constexpr Date first_day_of_year() const noexcept {
-        return Date(year_, 1, 1);
+        return Date(unchecked, year_, 1, 1);
     }
     
     /**
@@ -429,8 +508,19 @@ public:
      * @return Date representing December 31 of this year
      */
     [[nodiscard]] constexpr Date last_day_of_year() const noexcept {
-        return Date(year_, 12, 31);
+        return Date(unchecked, year_, 12, 31);
     }
 };
 
 } // namespace zuu
+
+/**
+ * @brief Hash for zuu::Date (unordered containers, hash joins)
+ */
+template <>
+struct std::hash<zuu::Date> {
+    [[nodiscard]] constexpr size_t operator()(const zuu::Date& d) const noexcept {
+        return static_cast<size_t>(zuu::detail::hash_mix(d.packed()));
+    }
+};
+
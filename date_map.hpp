@@ -0,0 +1,329 @@
+/**
+ * @file date_map.hpp
+ * @brief Dense per-day and per-month containers indexed by calendar position
+ * @author zuudevs (zuudevs@gmail.com)
+ * @version 1.1.1
+ * @date 2026-10-16
+ */
+
+#pragma once
+
+#include "date_core.hpp"
+#include <algorithm>
+#include <numeric>
+#include <span>
+#include <stdexcept>
+#include <vector>
+
+namespace zuu {
+
+namespace detail {
+
+    /// One slot per day; slot i of a map starting at origin is origin + i days
+    struct DayIndex {
+        static constexpr int64_t index(const Date& origin, const Date& d) noexcept {
+            return d.days_between(origin);
+        }
+        static constexpr Date date_at(const Date& origin, int64_t i) noexcept {
+            return Date(origin).add_days(static_cast<int32_t>(i));
+        }
+        static constexpr Date normalize(const Date& d) noexcept { return d; }
+        static constexpr Date next(Date d) noexcept { return d.add_days(1); }
+    };
+
+    /// One slot per month; keys are normalised to the first day of the month
+    struct MonthIndex {
+        static constexpr int64_t index(const Date& origin, const Date& d) noexcept {
+            return (int64_t{d.year()} * 12 + d.month()) - (int64_t{origin.year()} * 12 + origin.month());
+        }
+        static constexpr Date date_at(const Date& origin, int64_t i) noexcept {
+            return Date(origin).add_months(static_cast<int32_t>(i));
+        }
+        static constexpr Date normalize(const Date& d) noexcept { return d.first_day_of_month(); }
+        static constexpr Date next(Date d) noexcept {
+            return d.month() == 12 ? Date(unchecked, d.year() + 1, 1, 1) : Date(unchecked, d.year(), d.month() + 1, 1);
+        }
+    };
+
+} // namespace detail
+
+/**
+ * @class CalendarMap
+ * @brief Contiguous array of T covering a growing, gap-free calendar range
+ *
+ * @details
+ * Slots are addressed by their distance from the first slot (days_between
+ * for DateMap, month difference for YearMonthMap), so lookups are O(1)
+ * with no hashing or tree walk. Writing outside the current range grows
+ * it, doubling the spare capacity on the side that grew; new slots are
+ * value-initialised (0 for arithmetic types).
+ *
+ * Values are stored in calendar order in one array, so values() can go
+ * straight into vectorisable loops and running_total() / sum() are plain
+ * scans over it.
+ *
+ * @tparam T Value type
+ * @tparam Index detail::DayIndex or detail::MonthIndex
+ */
+template <typename T, typename Index>
+class CalendarMap {
+private:
+    std::vector<T> storage_;   ///< Capacity, including spare slots on both sides
+    Date origin_;              ///< Date of storage_[0]
+    size_t begin_ = 0;         ///< First used slot
+    size_t end_ = 0;           ///< One past the last used slot
+
+    [[nodiscard]] int64_t slot(const Date& d) const noexcept { return Index::index(origin_, d); }
+
+    /// Make the slot for d part of the used range; returns its position in storage_
+    size_t cover(const Date& d) {
+        if (begin_ == end_) {
+            storage_.assign(std::max<size_t>(storage_.size(), 1), T{});
+            origin_ = Index::normalize(d);
+            begin_ = 0;
+            end_ = 1;
+            return 0;
+        }
+        int64_t s = slot(d);
+        if (s < 0) {
+            // Grow to the left by max(size, needed), but never past 0001-01-01
+            size_t need = static_cast<size_t>(-s);
+            size_t room = static_cast<size_t>(-Index::index(origin_, Date(unchecked, 1, 1, 1)));
+            size_t extra = std::min(std::max(need, end_ - begin_), room);
+            std::vector<T> grown(storage_.size() + extra);
+            std::move(storage_.begin() + static_cast<ptrdiff_t>(begin_), storage_.begin() + static_cast<ptrdiff_t>(end_),
+                      grown.begin() + static_cast<ptrdiff_t>(begin_ + extra));
+            storage_.swap(grown);
+            origin_ = Index::date_at(origin_, -static_cast<int64_t>(extra));
+            begin_ += extra;
+            end_ += extra;
+            s += static_cast<int64_t>(extra);
+        } else if (s >= static_cast<int64_t>(storage_.size())) {
+            size_t need = static_cast<size_t>(s) + 1 - storage_.size();
+            storage_.resize(storage_.size() + std::max(need, end_ - begin_));
+        }
+        size_t pos = static_cast<size_t>(s);
+        if (pos < begin_) {
+            std::fill(storage_.begin() + static_cast<ptrdiff_t>(pos), storage_.begin() + static_cast<ptrdiff_t>(begin_), T{});
+            begin_ = pos;
+        } else if (pos >= end_) {
+            std::fill(storage_.begin() + static_cast<ptrdiff_t>(end_), storage_.begin() + static_cast<ptrdiff_t>(pos + 1), T{});
+            end_ = pos + 1;
+        }
+        return pos;
+    }
+
+public:
+    /**
+     * @brief Key/value pair produced by iteration
+     */
+    template <typename V>
+    struct Entry {
+        Date date;   ///< Day (DateMap) or first day of the month (YearMonthMap)
+        V& value;
+    };
+
+    /**
+     * @brief Forward iterator in calendar order; the date advances incrementally
+     */
+    template <typename V>
+    class Iterator {
+    private:
+        V* ptr_ = nullptr;
+        Date date_;
+
+    public:
+        using iterator_category = std::forward_iterator_tag;
+        using value_type = Entry<V>;
+        using difference_type = std::ptrdiff_t;
+        using reference = Entry<V>;
+
+        constexpr Iterator() noexcept = default;
+        constexpr Iterator(V* ptr, Date date) noexcept : ptr_(ptr), date_(date) {}
+
+        [[nodiscard]] constexpr Entry<V> operator*() const noexcept { return Entry<V>{date_, *ptr_}; }
+        constexpr Iterator& operator++() noexcept {
+            ++ptr_;
+            date_ = Index::next(date_);
+            return *this;
+        }
+        constexpr Iterator operator++(int) noexcept {
+            Iterator old = *this;
+            ++*this;
+            return old;
+        }
+        [[nodiscard]] constexpr bool operator==(const Iterator& other) const noexcept { return ptr_ == other.ptr_; }
+    };
+
+    using iterator = Iterator<T>;
+    using const_iterator = Iterator<const T>;
+
+    /**
+     * @brief Create an empty map
+     */
+    CalendarMap() = default;
+
+    /**
+     * @brief Create a map covering [first, last], all values T{}
+     * @throw std::invalid_argument if last < first
+     */
+    CalendarMap(const Date& first, const Date& last) {
+        if (last < first) throw std::invalid_argument("CalendarMap range is reversed");
+        origin_ = Index::normalize(first);
+        storage_.resize(static_cast<size_t>(slot(last)) + 1);
+        begin_ = 0;
+        end_ = storage_.size();
+    }
+
+    // ========================================================================
+    // Access
+    // ========================================================================
+
+    /**
+     * @brief Access the value for a date, growing the range if needed
+     */
+    T& operator[](const Date& d) { return storage_[cover(d)]; }
+
+    /**
+     * @brief Access the value for a date
+     * @throw std::out_of_range if d is outside [first(), last()]
+     */
+    [[nodiscard]] const T& at(const Date& d) const {
+        if (const T* p = find(d)) return *p;
+        throw std::out_of_range("Date outside CalendarMap range");
+    }
+
+    /**
+     * @brief Access the value for a date
+     * @throw std::out_of_range if d is outside [first(), last()]
+     */
+    [[nodiscard]] T& at(const Date& d) {
+        if (T* p = find(d)) return *p;
+        throw std::out_of_range("Date outside CalendarMap range");
+    }
+
+    /**
+     * @brief Get a pointer to the value for a date, or nullptr outside the range
+     */
+    [[nodiscard]] const T* find(const Date& d) const noexcept {
+        int64_t s = slot(d);
+        return contains_slot(s) ? &storage_[static_cast<size_t>(s)] : nullptr;
+    }
+
+    [[nodiscard]] T* find(const Date& d) noexcept {
+        int64_t s = slot(d);
+        return contains_slot(s) ? &storage_[static_cast<size_t>(s)] : nullptr;
+    }
+
+    /**
+     * @brief Check if a date lies inside the covered range
+     */
+    [[nodiscard]] bool contains(const Date& d) const noexcept { return contains_slot(slot(d)); }
+
+    // ========================================================================
+    // Range
+    // ========================================================================
+
+    /**
+     * @brief Get the first covered date (first day of the month for YearMonthMap)
+     * @pre !empty()
+     */
+    [[nodiscard]] Date first() const noexcept { return Index::date_at(origin_, static_cast<int64_t>(begin_)); }
+
+    /**
+     * @brief Get the last covered date (first day of the month for YearMonthMap)
+     * @pre !empty()
+     */
+    [[nodiscard]] Date last() const noexcept { return Index::date_at(origin_, static_cast<int64_t>(end_) - 1); }
+
+    /**
+     * @brief Get the number of covered days or months
+     */
+    [[nodiscard]] size_t size() const noexcept { return end_ - begin_; }
+
+    /**
+     * @brief Check if the map covers nothing
+     */
+    [[nodiscard]] bool empty() const noexcept { return begin_ == end_; }
+
+    /**
+     * @brief Remove all values
+     */
+    void clear() noexcept { begin_ = end_ = 0; }
+
+    /**
+     * @brief Get all values in calendar order (contiguous)
+     */
+    [[nodiscard]] std::span<T> values() noexcept { return {storage_.data() + begin_, size()}; }
+    [[nodiscard]] std::span<const T> values() const noexcept { return {storage_.data() + begin_, size()}; }
+
+    /**
+     * @brief Get the values for [from, to], clipped to the covered range
+     */
+    [[nodiscard]] std::span<const T> values(const Date& from, const Date& to) const noexcept {
+        int64_t lo = std::max(slot(from), static_cast<int64_t>(begin_));
+        int64_t hi = std::min(slot(to) + 1, static_cast<int64_t>(end_));
+        if (hi <= lo) return {};
+        return {storage_.data() + lo, static_cast<size_t>(hi - lo)};
+    }
+
+    [[nodiscard]] iterator begin() noexcept { return iterator(storage_.data() + begin_, empty() ? Date() : first()); }
+    [[nodiscard]] iterator end() noexcept { return iterator(storage_.data() + end_, Date()); }
+    [[nodiscard]] const_iterator begin() const noexcept {
+        return const_iterator(storage_.data() + begin_, empty() ? Date() : first());
+    }
+    [[nodiscard]] const_iterator end() const noexcept { return const_iterator(storage_.data() + end_, Date()); }
+
+    // ========================================================================
+    // Cumulative Queries
+    // ========================================================================
+
+    /**
+     * @brief Sum of the values for [from, to] (clipped to the covered range)
+     */
+    [[nodiscard]] T sum(const Date& from, const Date& to) const {
+        auto v = values(from, to);
+        return std::reduce(v.begin(), v.end(), T{});
+    }
+
+    /**
+     * @brief Map of running totals: result[d] = sum of values from first() through d
+     *
+     * @details With the totals, sum over any [a, b] is totals[b] - totals[a - 1]
+     * in O(1). The scan runs over the contiguous value array.
+     */
+    [[nodiscard]] CalendarMap running_total() const {
+        CalendarMap out;
+        out.origin_ = first();
+        out.storage_.resize(size());
+        out.end_ = size();
+        if (!empty()) std::inclusive_scan(values().begin(), values().end(), out.storage_.begin());
+        return out;
+    }
+
+private:
+    [[nodiscard]] bool contains_slot(int64_t s) const noexcept {
+        return s >= static_cast<int64_t>(begin_) && s < static_cast<int64_t>(end_);
+    }
+};
+
+/**
+ * @brief Per-day values, e.g. revenue per day
+ *
+ * @code
+ * zuu::DateMap<double> revenue;
+ * for (const auto& sale : sales) revenue[sale.date] += sale.amount;
+ * for (auto [day, total] : revenue) std::cout << day.format() << ' ' << total << '\n';
+ * double march = revenue.sum(zuu::Date(2024, 3, 1), zuu::Date(2024, 3, 31));
+ * @endcode
+ */
+template <typename T>
+using DateMap = CalendarMap<T, detail::DayIndex>;
+
+/**
+ * @brief Per-month values; any day of a month addresses that month's slot
+ */
+template <typename T>
+using YearMonthMap = CalendarMap<T, detail::MonthIndex>;
+
+} // namespace zuu
@@ -0,0 +1,376 @@
+/**
+ * @file date_range.hpp
+ * @brief Lazy, allocation-free calendar range views
+ * @author zuudevs (zuudevs@gmail.com)
+ * @version 1.1.1
+ * @date 2026-10-16
+ */
+
+#pragma once
+
+#include "datetime_core.hpp"
+#include "duration_core.hpp"
+#include <iterator>
+#include <ranges>
+#include <stdexcept>
+
+namespace zuu {
+
+namespace detail {
+
+    /// Year/month/day cursor advanced by carrying into the month and year
+    struct CalendarCursor {
+        int y = 1;
+        int m = 1;
+        int d = 1;
+
+        constexpr CalendarCursor() noexcept = default;
+        constexpr explicit CalendarCursor(const Date& date) noexcept
+            : y(date.year()), m(date.month()), d(date.day()) {}
+
+        [[nodiscard]] constexpr uint32_t packed() const noexcept {
+            return (static_cast<uint32_t>(y) << 16) | (static_cast<uint32_t>(m) << 8) | static_cast<uint32_t>(d);
+        }
+
+        [[nodiscard]] constexpr Date date() const noexcept { return Date(unchecked, y, m, d); }
+
+        /// Advance by 0..28 days; past 9999-12-31 the year becomes 10000
+        constexpr void add_small(int days) noexcept {
+            d += days;
+            int dim = days_in_month(m, y);
+            if (d > dim) {
+                d -= dim;
+                if (++m > 12) { m = 1; ++y; }
+            }
+        }
+
+        constexpr void next_month() noexcept {
+            if (++m > 12) { m = 1; ++y; }
+        }
+
+        constexpr bool operator==(const CalendarCursor&) const noexcept = default;
+    };
+
+    /// Every day
+    struct DayStep {
+        CalendarCursor c;
+
+        constexpr DayStep() noexcept = default;
+        constexpr explicit DayStep(const Date& from) noexcept : c(from) {}
+
+        [[nodiscard]] constexpr Date value() const noexcept { return c.date(); }
+        [[nodiscard]] constexpr uint32_t key() const noexcept { return c.packed(); }
+        constexpr void advance() noexcept { c.add_small(1); }
+        constexpr bool operator==(const DayStep&) const noexcept = default;
+    };
+
+    /// Monday to Friday; Friday jumps straight to Monday
+    struct WeekdayStep {
+        CalendarCursor c;
+        int dow = 0;   ///< 0=Monday
+
+        constexpr WeekdayStep() noexcept = default;
+        constexpr explicit WeekdayStep(const Date& from) noexcept : c(from), dow(from.day_of_week()) {
+            if (dow >= 5) {
+                c.add_small(7 - dow);
+                dow = 0;
+            }
+        }
+
+        [[nodiscard]] constexpr Date value() const noexcept { return c.date(); }
+        [[nodiscard]] constexpr uint32_t key() const noexcept { return c.packed(); }
+        constexpr void advance() noexcept {
+            if (dow == 4) {
+                c.add_small(3);
+                dow = 0;
+            } else {
+                c.add_small(1);
+                ++dow;
+            }
+        }
+        constexpr bool operator==(const WeekdayStep&) const noexcept = default;
+    };
+
+    /// Same day of month as the start, clamped to shorter months
+    struct MonthStep {
+        CalendarCursor c;   ///< d holds the anchor day, not the clamped one
+
+        constexpr MonthStep() noexcept = default;
+        constexpr explicit MonthStep(const Date& from) noexcept : c(from) {}
+
+        [[nodiscard]] constexpr int day() const noexcept {
+            int dim = days_in_month(c.m, c.y);
+            return c.d < dim ? c.d : dim;
+        }
+        [[nodiscard]] constexpr Date value() const noexcept { return Date(unchecked, c.y, c.m, day()); }
+        [[nodiscard]] constexpr uint32_t key() const noexcept {
+            return (static_cast<uint32_t>(c.y) << 16) | (static_cast<uint32_t>(c.m) << 8) | static_cast<uint32_t>(day());
+        }
+        constexpr void advance() noexcept { c.next_month(); }
+        constexpr bool operator==(const MonthStep&) const noexcept = default;
+    };
+
+    /// Last day of each month
+    struct MonthEndStep {
+        CalendarCursor c;   ///< d is unused
+
+        constexpr MonthEndStep() noexcept = default;
+        constexpr explicit MonthEndStep(const Date& from) noexcept : c(from) {}
+
+        [[nodiscard]] constexpr Date value() const noexcept { return Date(unchecked, c.y, c.m, days_in_month(c.m, c.y)); }
+        [[nodiscard]] constexpr uint32_t key() const noexcept {
+            return (static_cast<uint32_t>(c.y) << 16) | (static_cast<uint32_t>(c.m) << 8) |
+                   static_cast<uint32_t>(days_in_month(c.m, c.y));
+        }
+        constexpr void advance() noexcept { c.next_month(); }
+        constexpr bool operator==(const MonthEndStep&) const noexcept = default;
+    };
+
+} // namespace detail
+
+// ============================================================================
+// Date Range Views
+// ============================================================================
+
+/**
+ * @class DateRangeView
+ * @brief Lazy inclusive range of dates produced by a step policy
+ *
+ * @details
+ * Iterators keep the year, month and day as plain integers and step them
+ * with carries (the month only rolls at month end), so an increment costs
+ * a few instructions and nothing is allocated or revalidated. The end test
+ * compares packed year/month/day keys against the last date.
+ *
+ * Models std::ranges::view and forward_range, so the views compose with
+ * std::views and std::ranges algorithms.
+ *
+ * @tparam Step detail::DayStep, WeekdayStep, MonthStep or MonthEndStep
+ */
+template <typename Step>
+class DateRangeView : public std::ranges::view_interface<DateRangeView<Step>> {
+public:
+    /**
+     * @brief End marker: reached once the current date passes the last one
+     */
+    struct sentinel {
+        uint32_t last = 0;   ///< Packed last date
+    };
+
+    /**
+     * @brief Forward iterator yielding Date by value
+     */
+    class iterator {
+    private:
+        Step step_;
+
+    public:
+        using iterator_concept = std::forward_iterator_tag;
+        using iterator_category = std::forward_iterator_tag;
+        using value_type = Date;
+        using difference_type = std::ptrdiff_t;
+        using reference = Date;
+
+        constexpr iterator() noexcept = default;
+        constexpr explicit iterator(const Step& step) noexcept : step_(step) {}
+
+        [[nodiscard]] constexpr Date operator*() const noexcept { return step_.value(); }
+        constexpr iterator& operator++() noexcept {
+            step_.advance();
+            return *this;
+        }
+        constexpr iterator operator++(int) noexcept {
+            iterator old = *this;
+            step_.advance();
+            return old;
+        }
+
+        [[nodiscard]] constexpr bool operator==(const iterator& other) const noexcept { return step_ == other.step_; }
+        [[nodiscard]] constexpr bool operator==(const sentinel& s) const noexcept { return step_.key() > s.last; }
+    };
+
+private:
+    Step first_;
+    uint32_t last_ = 0;
+
+public:
+    constexpr DateRangeView() noexcept = default;
+
+    /**
+     * @brief Range of dates from the step policy starting at from, up to and including to
+     */
+    constexpr DateRangeView(const Date& from, const Date& to) noexcept : first_(from), last_(to.packed()) {}
+
+    [[nodiscard]] constexpr iterator begin() const noexcept { return iterator(first_); }
+    [[nodiscard]] constexpr sentinel end() const noexcept { return sentinel{last_}; }
+};
+
+/**
+ * @brief Every day in [from, to]
+ *
+ * @code
+ * for (zuu::Date d : zuu::days(zuu::Date(2024, 1, 1), zuu::Date(2024, 12, 31))) { ... }
+ * @endcode
+ */
+[[nodiscard]] constexpr DateRangeView<detail::DayStep> days(const Date& from, const Date& to) noexcept {
+    return {from, to};
+}
+
+/**
+ * @brief Every Monday-Friday in [from, to]
+ */
+[[nodiscard]] constexpr DateRangeView<detail::WeekdayStep> weekdays(const Date& from, const Date& to) noexcept {
+    return {from, to};
+}
+
+/**
+ * @brief from, then the same day of each following month (clamped to month length), up to to
+ *
+ * @details Starting on Jan 31 yields Jan 31, Feb 28/29, Mar 31, Apr 30, ...
+ */
+[[nodiscard]] constexpr DateRangeView<detail::MonthStep> months(const Date& from, const Date& to) noexcept {
+    return {from, to};
+}
+
+/**
+ * @brief Last day of every month whose month end lies in [from, to]
+ */
+[[nodiscard]] constexpr DateRangeView<detail::MonthEndStep> month_ends(const Date& from, const Date& to) noexcept {
+    return {from, to};
+}
+
+// ============================================================================
+// DateTime Stepping
+// ============================================================================
+
+/**
+ * @class DateTimeStepView
+ * @brief Lazy range start, start + step, start + 2*step, ... up to an inclusive end
+ *
+ * @details
+ * The step is split once into whole days and a sub-day remainder. Each
+ * increment adds the remainder to the time of day, carries at most one
+ * day, and moves the date with carry arithmetic (through the serial day
+ * only for steps longer than four weeks).
+ */
+class DateTimeStepView : public std::ranges::view_interface<DateTimeStepView> {
+public:
+    /**
+     * @brief End marker: reached once the current value passes the last one
+     */
+    struct sentinel {
+        uint32_t last_date = 0;   ///< Packed last date
+        uint64_t last_nanos = 0;  ///< Nanoseconds of day of the last value
+    };
+
+    /**
+     * @brief Forward iterator yielding DateTime by value
+     */
+    class iterator {
+    private:
+        detail::CalendarCursor c_;
+        uint64_t nanos_ = 0;       ///< Nanoseconds since midnight
+        int64_t step_days_ = 0;
+        uint64_t step_nanos_ = 0;  ///< Always < NANOS_PER_DAY
+
+    public:
+        using iterator_concept = std::forward_iterator_tag;
+        using iterator_category = std::forward_iterator_tag;
+        using value_type = DateTime;
+        using difference_type = std::ptrdiff_t;
+        using reference = DateTime;
+
+        constexpr iterator() noexcept = default;
+        constexpr iterator(const DateTime& start, int64_t step_days, uint64_t step_nanos) noexcept
+            : c_(start.get_date()), nanos_(start.get_time().total_nanoseconds()),
+              step_days_(step_days), step_nanos_(step_nanos) {}
+
+        [[nodiscard]] constexpr DateTime operator*() const noexcept {
+            return DateTime(c_.date(), Time(unchecked, nanos_));
+        }
+
+        constexpr iterator& operator++() noexcept {
+            nanos_ += step_nanos_;
+            int64_t days = step_days_;
+            if (nanos_ >= detail::NANOS_PER_DAY) {
+                nanos_ -= detail::NANOS_PER_DAY;
+                ++days;
+            }
+            if (days <= 28) {
+                c_.add_small(static_cast<int>(days));
+            } else {
+                int64_t serial = static_cast<int64_t>(c_.date().to_unix_days()) + days;
+                if (serial > detail::MAX_UNIX_DAYS) {
+                    c_ = detail::CalendarCursor();
+                    c_.y = detail::MAX_YEAR + 1;   // past every sentinel
+                } else {
+                    c_ = detail::CalendarCursor(Date::from_unix_days(static_cast<int32_t>(serial)));
+                }
+            }
+            return *this;
+        }
+        constexpr iterator operator++(int) noexcept {
+            iterator old = *this;
+            ++*this;
+            return old;
+        }
+
+        [[nodiscard]] constexpr bool operator==(const iterator& other) const noexcept {
+            return c_ == other.c_ && nanos_ == other.nanos_;
+        }
+        [[nodiscard]] constexpr bool operator==(const sentinel& s) const noexcept {
+            uint32_t key = c_.packed();
+            return key > s.last_date || (key == s.last_date && nanos_ > s.last_nanos);
+        }
+    };
+
+private:
+    DateTime start_;
+    DateTime last_;
+    int64_t step_days_ = 0;
+    uint64_t step_nanos_ = 0;
+
+public:
+    constexpr DateTimeStepView() noexcept = default;
+
+    /**
+     * @brief Values start + k * step for k >= 0 that are <= last
+     * @throw std::invalid_argument if step is not positive
+     */
+    constexpr DateTimeStepView(const DateTime& start, const DateTime& last, const Duration& step)
+        : start_(start), last_(last) {
+        int64_t ns = step.total_nanoseconds();
+        if (ns <= 0) throw std::invalid_argument("Step must be positive");
+        step_days_ = ns / static_cast<int64_t>(detail::NANOS_PER_DAY);
+        step_nanos_ = static_cast<uint64_t>(ns % static_cast<int64_t>(detail::NANOS_PER_DAY));
+    }
+
+    [[nodiscard]] constexpr iterator begin() const noexcept { return iterator(start_, step_days_, step_nanos_); }
+    [[nodiscard]] constexpr sentinel end() const noexcept {
+        return sentinel{last_.get_date().packed(), last_.get_time().total_nanoseconds()};
+    }
+};
+
+/**
+ * @brief start, start + step, ... up to and including last
+ * @throw std::invalid_argument if step is not positive
+ *
+ * @code
+ * for (zuu::DateTime t : zuu::every(open, close, zuu::Duration::from_minutes(15))) { ... }
+ * @endcode
+ */
+[[nodiscard]] constexpr DateTimeStepView every(const DateTime& start, const DateTime& last, const Duration& step) {
+    return DateTimeStepView(start, last, step);
+}
+
+/**
+ * @brief start, start + step, ... until 9999-12-31 23:59:59.999999999
+ * @throw std::invalid_argument if step is not positive
+ *
+ * @details Combine with std::views::take or take_while to bound it.
+ */
+[[nodiscard]] constexpr DateTimeStepView every(const DateTime& start, const Duration& step) {
+    return DateTimeStepView(start, DateTime(unchecked, detail::MAX_YEAR, 12, 31, 23, 59, 59, 999'999'999), step);
+}
+
+} // namespace zuu
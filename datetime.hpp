@@ -25,6 +25,19 @@
  * #include "datetime.hpp"
  * @endcode
  * 
+ * datetime.hpp includes the core value types only: the *_core.hpp headers
+ * (Date, Time, DateTime, Duration, Period, Interval/IntervalSet) and what
+ * they depend on. Every other module is opt-in and included on its own, so
+ * a translation unit does not pay for threads, intrinsics or file I/O it
+ * does not use:
+ * - Parsing and formatting: http_date.hpp, log_timestamp.hpp,
+ *   epoch_text.hpp, iso8601_batch.hpp, streaming_formatter.hpp
+ * - Time scales and clocks: leap_seconds.hpp, tsc_clock.hpp
+ * - Bulk data: datetime_columns.hpp, datetime_sort.hpp, interval_index.hpp,
+ *   timestamp_stats.hpp
+ * - Calendar utilities: rounding.hpp, date_range.hpp, date_map.hpp,
+ *   basic_time.hpp
+ * 
  * @section usage_sec Basic Usage
  * 
  * @subsection date_usage Date Operations
@@ -135,10 +148,13 @@
 
 #pragma once
 
-// Include all components
+// Core value types only; see the module list above for the opt-in headers
 #include "date_core.hpp"
 #include "time_core.hpp"
 #include "datetime_core.hpp"
+#include "duration_core.hpp"
+#include "period_core.hpp"
+#include "interval_core.hpp"
 
 /**
  * @namespace zuu
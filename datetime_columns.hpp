@@ -0,0 +1,361 @@
+/**
+ * @file datetime_columns.hpp
+ * @brief Bulk validation and conversion of columnar date/time components
+ * @author zuudevs (zuudevs@gmail.com)
+ * @version 1.1.1
+ * @date 2026-10-16
+ */
+
+#pragma once
+
+#include "datetime_core.hpp"
+#include "datetime_parallel.hpp"
+#include <algorithm>
+#include <bit>
+#include <span>
+#include <stdexcept>
+#include <vector>
+
+namespace zuu {
+
+/**
+ * @brief Broken-down dates stored as separate columns
+ */
+struct DateColumns {
+    std::span<const int32_t> year;    ///< Year [1-9999]
+    std::span<const int32_t> month;   ///< Month [1-12]
+    std::span<const int32_t> day;     ///< Day [1-31]
+
+    /// Number of complete rows
+    [[nodiscard]] constexpr size_t size() const noexcept {
+        return std::min({year.size(), month.size(), day.size()});
+    }
+};
+
+/**
+ * @brief Broken-down times of day stored as separate columns
+ */
+struct TimeColumns {
+    std::span<const int32_t> hour;         ///< Hour [0-23]
+    std::span<const int32_t> minute;       ///< Minute [0-59]
+    std::span<const int32_t> second;       ///< Second [0-59]
+    std::span<const int32_t> nanosecond;   ///< Nanosecond [0-999999999]; may be empty (all 0)
+
+    /// Number of complete rows
+    [[nodiscard]] constexpr size_t size() const noexcept {
+        return std::min({hour.size(), minute.size(), second.size()});
+    }
+};
+
+/**
+ * @brief Number of 64-bit words in a validity bitmap for n rows
+ */
+[[nodiscard]] constexpr size_t bitmap_words(size_t n) noexcept { return (n + 63) / 64; }
+
+/**
+ * @brief Test bit i of a validity bitmap
+ */
+[[nodiscard]] constexpr bool bitmap_test(std::span<const uint64_t> bitmap, size_t i) noexcept {
+    return (bitmap[i / 64] >> (i % 64)) & 1;
+}
+
+namespace detail {
+
+    /// Month lengths indexed by month - 1; entries 12-15 make bad months fail
+    inline constexpr uint8_t MONTH_LENGTH16[16] = {31, 28, 31, 30, 31, 30, 31, 31, 30, 31, 30, 31, 0, 0, 0, 0};
+
+    /// Serial days with an int64 nanosecond range for the whole day
+    constexpr int32_t MIN_NANOS_DAYS = -106751;   ///< 1677-09-22
+    constexpr int32_t MAX_NANOS_DAYS = 106750;    ///< 2262-04-10
+
+    /// Branch-free is_valid_date()
+    constexpr bool row_valid_date(int32_t y, int32_t m, int32_t d) noexcept {
+        uint32_t um = static_cast<uint32_t>(m) - 1u;
+        uint32_t uy = static_cast<uint32_t>(y);
+        uint32_t leap = ((uy & 3) == 0) & (((uy % 25) != 0) | ((uy & 15) == 0));
+        uint32_t dim = MONTH_LENGTH16[um & 15] + (leap & (um == 1));
+        return (uy - 1u < 9999u) & (um < 12u) & (static_cast<uint32_t>(d) - 1u < dim);
+    }
+
+    /// Branch-free is_valid_time()
+    constexpr bool row_valid_time(int32_t h, int32_t m, int32_t s, int32_t ns) noexcept {
+        return (static_cast<uint32_t>(h) < 24u) & (static_cast<uint32_t>(m) < 60u) &
+               (static_cast<uint32_t>(s) < 60u) & (static_cast<uint32_t>(ns) < NANOS_PER_SECOND);
+    }
+
+    /**
+     * @brief Kernel shared by the public functions
+     *
+     * Validates rows [begin, end) (begin a multiple of 64), writes the
+     * bitmap words and, if requested, the serial day or epoch nanosecond
+     * of every row (0 for rejected rows). Returns the number of valid rows.
+     */
+    class ColumnKernel {
+    public:
+        const int32_t* y = nullptr;
+        const int32_t* mo = nullptr;
+        const int32_t* d = nullptr;
+        const int32_t* h = nullptr;    ///< Null when only dates are processed
+        const int32_t* mi = nullptr;
+        const int32_t* s = nullptr;
+        const int32_t* ns = nullptr;   ///< Null means nanosecond 0
+        int32_t* days_out = nullptr;
+        int64_t* nanos_out = nullptr;
+
+        size_t run(size_t begin, size_t end, uint64_t* words) const noexcept {
+            size_t valid = 0;
+            for (size_t w = begin; w < end; w += 64) {
+                size_t stop = std::min(end, w + 64);
+                uint64_t bits = 0;
+                size_t i = w;
+#if ZUU_HAS_AVX2
+                for (size_t k = 0; i + 8 <= stop; i += 8, k += 8) {
+                    bits |= static_cast<uint64_t>(block8(i)) << k;
+                }
+#endif
+                for (; i < stop; ++i) bits |= static_cast<uint64_t>(row(i)) << (i - w);
+                words[w / 64] = bits;
+                valid += static_cast<size_t>(std::popcount(bits));
+            }
+            return valid;
+        }
+
+    private:
+        bool row(size_t i) const noexcept {
+            int32_t ns_i = ns ? ns[i] : 0;
+            bool ok = row_valid_date(y[i], mo[i], d[i]);
+            if (h) ok &= row_valid_time(h[i], mi[i], s[i], ns_i);
+            if (!days_out && !nanos_out) return ok;
+            // Rejected rows are converted as 1970-01-01 00:00:00, i.e. 0
+            int32_t serial = days_from_civil(ok ? y[i] : 1970, ok ? mo[i] : 1, ok ? d[i] : 1);
+            if (nanos_out) {
+                ok &= (serial >= MIN_NANOS_DAYS) & (serial <= MAX_NANOS_DAYS);
+                int64_t sod = ok ? int64_t{h[i]} * SECONDS_PER_HOUR + int64_t{mi[i]} * SECONDS_PER_MINUTE + s[i] : 0;
+                nanos_out[i] = ok ? (int64_t{serial} * SECONDS_PER_DAY + sod) * NANOS_PER_SECOND + ns_i : 0;
+            }
+            if (days_out) days_out[i] = ok ? serial : 0;
+            return ok;
+        }
+
+#if ZUU_HAS_AVX2
+        /// x <= bound, unsigned, as a lane mask
+        static __m256i le_u32(__m256i x, uint32_t bound) noexcept {
+            return _mm256_cmpeq_epi32(_mm256_min_epu32(x, _mm256_set1_epi32(static_cast<int>(bound))), x);
+        }
+
+        static __m256i load(const int32_t* p) noexcept {
+            return _mm256_loadu_si256(reinterpret_cast<const __m256i*>(p));
+        }
+
+        /// Rows i..i+7: returns the 8 validity bits
+        unsigned block8(size_t i) const noexcept {
+            const __m256i one = _mm256_set1_epi32(1);
+            __m256i yv = load(y + i), mv = load(mo + i), dv = load(d + i);
+
+            // Leap year: divisible by 4, and not by 100 unless by 400.
+            // x % 25 == 0  <=>  x * 25^-1 (mod 2^32) <= (2^32 - 1) / 25
+            __m256i div4 = _mm256_cmpeq_epi32(_mm256_and_si256(yv, _mm256_set1_epi32(3)), _mm256_setzero_si256());
+            __m256i div16 = _mm256_cmpeq_epi32(_mm256_and_si256(yv, _mm256_set1_epi32(15)), _mm256_setzero_si256());
+            __m256i div25 = le_u32(_mm256_mullo_epi32(yv, _mm256_set1_epi32(static_cast<int>(0xC28F5C29u))), 171798691u);
+            __m256i leap = _mm256_andnot_si256(_mm256_andnot_si256(div16, div25), div4);
+
+            // Month length by byte shuffle; control bytes 0x80 zero the upper bytes of each lane
+            __m256i m1 = _mm256_sub_epi32(mv, one);
+            const __m256i table = _mm256_broadcastsi128_si256(
+                _mm_loadu_si128(reinterpret_cast<const __m128i*>(MONTH_LENGTH16)));
+            __m256i ctrl = _mm256_or_si256(_mm256_and_si256(m1, _mm256_set1_epi32(15)),
+                                           _mm256_set1_epi32(static_cast<int>(0x80808000u)));
+            __m256i dim = _mm256_shuffle_epi8(table, ctrl);
+            dim = _mm256_sub_epi32(dim, _mm256_and_si256(leap, _mm256_cmpeq_epi32(m1, one)));   // +1 for a leap February
+
+            __m256i ok = _mm256_and_si256(le_u32(_mm256_sub_epi32(yv, one), 9998u), le_u32(m1, 11u));
+            __m256i d1 = _mm256_sub_epi32(dv, one);
+            ok = _mm256_and_si256(ok, _mm256_cmpeq_epi32(_mm256_min_epu32(d1, _mm256_sub_epi32(dim, one)), d1));
+
+            __m256i hv = _mm256_setzero_si256(), miv = hv, sv = hv, nsv = hv;
+            if (h) {
+                hv = load(h + i);
+                miv = load(mi + i);
+                sv = load(s + i);
+                if (ns) nsv = load(ns + i);
+                ok = _mm256_and_si256(ok, _mm256_and_si256(le_u32(hv, 23u), le_u32(miv, 59u)));
+                ok = _mm256_and_si256(ok, _mm256_and_si256(le_u32(sv, 59u), le_u32(nsv, NANOS_PER_SECOND - 1)));
+            }
+
+            if (days_out || nanos_out) {
+                // Rejected rows become 1970-01-01 00:00:00 so the arithmetic stays in range
+                yv = _mm256_blendv_epi8(_mm256_set1_epi32(1970), yv, ok);
+                mv = _mm256_blendv_epi8(one, mv, ok);
+                dv = _mm256_blendv_epi8(one, dv, ok);
+
+                // days_from_civil with divisions by 5, 25 as multiply-shift (exact for these ranges)
+                __m256i jan_feb = _mm256_cmpgt_epi32(_mm256_set1_epi32(3), mv);
+                __m256i ys = _mm256_add_epi32(yv, jan_feb);   // year starting in March
+                __m256i mp = _mm256_add_epi32(_mm256_sub_epi32(mv, _mm256_set1_epi32(3)),
+                                              _mm256_and_si256(jan_feb, _mm256_set1_epi32(12)));
+                __m256i doy = _mm256_srli_epi32(
+                    _mm256_mullo_epi32(_mm256_add_epi32(_mm256_mullo_epi32(mp, _mm256_set1_epi32(153)),
+                                                        _mm256_set1_epi32(2)),
+                                       _mm256_set1_epi32(52429)), 18);   // (153 * mp + 2) / 5
+                __m256i q4 = _mm256_srli_epi32(ys, 2);
+                __m256i q100 = _mm256_srli_epi32(_mm256_mullo_epi32(q4, _mm256_set1_epi32(5243)), 17);
+                __m256i q400 = _mm256_srli_epi32(_mm256_mullo_epi32(_mm256_srli_epi32(ys, 4), _mm256_set1_epi32(5243)), 17);
+                __m256i serial = _mm256_add_epi32(_mm256_mullo_epi32(ys, _mm256_set1_epi32(365)),
+                                                  _mm256_sub_epi32(q4, q100));
+                serial = _mm256_add_epi32(_mm256_add_epi32(serial, q400), _mm256_add_epi32(doy, dv));
+                serial = _mm256_sub_epi32(serial, _mm256_set1_epi32(719468 + 1));
+
+                if (nanos_out) {
+                    ok = _mm256_and_si256(ok, _mm256_and_si256(
+                        _mm256_cmpgt_epi32(serial, _mm256_set1_epi32(MIN_NANOS_DAYS - 1)),
+                        _mm256_cmpgt_epi32(_mm256_set1_epi32(MAX_NANOS_DAYS + 1), serial)));
+                    serial = _mm256_and_si256(serial, ok);
+                    __m256i sod = _mm256_add_epi32(_mm256_mullo_epi32(hv, _mm256_set1_epi32(SECONDS_PER_HOUR)),
+                                                   _mm256_mullo_epi32(miv, _mm256_set1_epi32(SECONDS_PER_MINUTE)));
+                    sod = _mm256_and_si256(_mm256_add_epi32(sod, sv), ok);
+                    nsv = _mm256_and_si256(nsv, ok);
+                    store_nanos(nanos_out + i, _mm256_castsi256_si128(serial), _mm256_castsi256_si128(sod),
+                                _mm256_castsi256_si128(nsv));
+                    store_nanos(nanos_out + i + 4, _mm256_extracti128_si256(serial, 1),
+                                _mm256_extracti128_si256(sod, 1), _mm256_extracti128_si256(nsv, 1));
+                }
+                if (days_out) {
+                    _mm256_storeu_si256(reinterpret_cast<__m256i*>(days_out + i), _mm256_and_si256(serial, ok));
+                }
+            }
+            return static_cast<unsigned>(_mm256_movemask_ps(_mm256_castsi256_ps(ok)));
+        }
+
+        /// (serial * 86400 + sod) * 1e9 + ns for four rows, in 64-bit lanes
+        static void store_nanos(int64_t* out, __m128i serial, __m128i sod, __m128i nsv) noexcept {
+            __m256i secs = _mm256_add_epi64(
+                _mm256_mul_epi32(_mm256_cvtepi32_epi64(serial), _mm256_set1_epi64x(SECONDS_PER_DAY)),
+                _mm256_cvtepi32_epi64(sod));
+            // 64 x 32-bit product from two 32 x 32 -> 64 multiplies (modular, so signs work out)
+            const __m256i giga = _mm256_set1_epi64x(NANOS_PER_SECOND);
+            __m256i lo = _mm256_mul_epu32(secs, giga);
+            __m256i hi = _mm256_slli_epi64(_mm256_mul_epu32(_mm256_srli_epi64(secs, 32), giga), 32);
+            __m256i nanos = _mm256_add_epi64(_mm256_add_epi64(lo, hi), _mm256_cvtepi32_epi64(nsv));
+            _mm256_storeu_si256(reinterpret_cast<__m256i*>(out), nanos);
+        }
+#endif
+    };
+
+    /// Run the kernel over n rows, split on 64-row boundaries across threads
+    inline size_t run_columns(const ColumnKernel& k, size_t n, std::span<uint64_t> valid) {
+        if (valid.size() < bitmap_words(n)) {
+            throw std::invalid_argument("Validity bitmap needs bitmap_words(n) words");
+        }
+        size_t words = bitmap_words(n);
+        size_t workers = worker_count(words, 1u << 10);
+        std::vector<size_t> counts(workers, 0);
+        parallel_chunks(words, workers, [&](size_t b, size_t e, size_t w) {
+            counts[w] = k.run(b * 64, std::min(n, e * 64), valid.data());
+        });
+        size_t total = 0;
+        for (size_t c : counts) total += c;
+        return total;
+    }
+
+} // namespace detail
+
+// ============================================================================
+// Validation
+// ============================================================================
+
+/**
+ * @brief Validate date columns into a bitmap
+ * @param dates Year, month and day columns
+ * @param valid Bitmap with at least bitmap_words(dates.size()) words; bit i is set if row i is a valid date
+ * @return Number of valid rows
+ * @throw std::invalid_argument if the bitmap is too small
+ *
+ * @details Uses AVX2 when the translation unit is compiled for it (month
+ * length by byte shuffle, leap years by multiply-compare, 8 rows per step)
+ * and a branch-free scalar loop otherwise. Large inputs are split across
+ * hardware threads.
+ */
+inline size_t validate_dates(const DateColumns& dates, std::span<uint64_t> valid) {
+    detail::ColumnKernel k;
+    k.y = dates.year.data();
+    k.mo = dates.month.data();
+    k.d = dates.day.data();
+    return detail::run_columns(k, dates.size(), valid);
+}
+
+/**
+ * @brief Validate date and time columns into a bitmap
+ * @param dates Year, month and day columns
+ * @param times Hour, minute, second and (optional) nanosecond columns
+ * @param valid Bitmap with at least bitmap_words(n) words
+ * @return Number of rows valid as both a date and a time of day
+ * @throw std::invalid_argument if the bitmap is too small or the nanosecond column is short
+ */
+inline size_t validate_datetimes(const DateColumns& dates, const TimeColumns& times, std::span<uint64_t> valid) {
+    size_t n = std::min(dates.size(), times.size());
+    if (!times.nanosecond.empty() && times.nanosecond.size() < n) {
+        throw std::invalid_argument("Nanosecond column shorter than the others");
+    }
+    detail::ColumnKernel k;
+    k.y = dates.year.data();
+    k.mo = dates.month.data();
+    k.d = dates.day.data();
+    k.h = times.hour.data();
+    k.mi = times.minute.data();
+    k.s = times.second.data();
+    k.ns = times.nanosecond.empty() ? nullptr : times.nanosecond.data();
+    return detail::run_columns(k, n, valid);
+}
+
+// ============================================================================
+// Conversion
+// ============================================================================
+
+/**
+ * @brief Validate date columns and convert them to days since 1970-01-01 in one pass
+ * @param dates Year, month and day columns
+ * @param out Serial days (rows processed: min(dates.size(), out.size())); rejected rows hold 0
+ * @param valid Bitmap with at least bitmap_words(n) words
+ * @return Number of valid rows
+ * @throw std::invalid_argument if the bitmap is too small
+ */
+inline size_t columns_to_unix_days(const DateColumns& dates, std::span<int32_t> out, std::span<uint64_t> valid) {
+    detail::ColumnKernel k;
+    k.y = dates.year.data();
+    k.mo = dates.month.data();
+    k.d = dates.day.data();
+    k.days_out = out.data();
+    return detail::run_columns(k, std::min(dates.size(), out.size()), valid);
+}
+
+/**
+ * @brief Validate date/time columns and convert them to Unix nanoseconds in one pass
+ * @param dates Year, month and day columns
+ * @param times Hour, minute, second and (optional) nanosecond columns
+ * @param out Unix nanoseconds (rows processed: min of all sizes); rejected rows hold 0
+ * @param valid Bitmap with at least bitmap_words(n) words
+ * @return Number of valid rows
+ * @throw std::invalid_argument if the bitmap is too small or the nanosecond column is short
+ *
+ * @note Rows are also rejected outside 1677-09-22..2262-04-10, the days an
+ * int64 nanosecond count covers completely.
+ */
+inline size_t columns_to_unix_nanos(const DateColumns& dates, const TimeColumns& times,
+                                    std::span<int64_t> out, std::span<uint64_t> valid) {
+    size_t n = std::min({dates.size(), times.size(), out.size()});
+    if (!times.nanosecond.empty() && times.nanosecond.size() < n) {
+        throw std::invalid_argument("Nanosecond column shorter than the others");
+    }
+    detail::ColumnKernel k;
+    k.y = dates.year.data();
+    k.mo = dates.month.data();
+    k.d = dates.day.data();
+    k.h = times.hour.data();
+    k.mi = times.minute.data();
+    k.s = times.second.data();
+    k.ns = times.nanosecond.empty() ? nullptr : times.nanosecond.data();
+    k.nanos_out = out.data();
+    return detail::run_columns(k, n, valid);
+}
+
+} // namespace zuu
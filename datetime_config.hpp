@@ -12,6 +12,14 @@
 #include <array>
 #include <string>
 
+/// 1 when the bulk kernels may use AVX2 (compile with -mavx2 or -march=native)
+#if defined(__AVX2__)
+    #define ZUU_HAS_AVX2 1
+    #include <immintrin.h>
+#else
+    #define ZUU_HAS_AVX2 0
+#endif
+
 namespace zuu {
 
 /**
@@ -43,7 +51,11 @@ namespace detail {
     // Year range
     constexpr int MIN_YEAR = 1;
     constexpr int MAX_YEAR = 9999;
-    
+
+    // Serial day range relative to the Unix epoch (1970-01-01)
+    constexpr int32_t MIN_UNIX_DAYS = -719162;   ///< 0001-01-01
+    constexpr int32_t MAX_UNIX_DAYS = 2932896;   ///< 9999-12-31
+
     /**
      * @brief Days in each month (non-leap year)
      */
@@ -87,7 +99,151 @@ namespace detail {
     constexpr std::array<const char*, 7> WEEKDAY_ABBREV = {
         "Mon", "Tue", "Wed", "Thu", "Fri", "Sat", "Sun"
     };
-    
+
+    /**
+     * @brief Pack three characters little-endian into a 24-bit key
+     */
+    constexpr uint32_t pack3(const char* s) noexcept {
+        return static_cast<uint32_t>(static_cast<unsigned char>(s[0])) |
+               static_cast<uint32_t>(static_cast<unsigned char>(s[1])) << 8 |
+               static_cast<uint32_t>(static_cast<unsigned char>(s[2])) << 16;
+    }
+
+    /**
+     * @brief Slot of a perfect-hash table over 3-letter abbreviations
+     */
+    struct AbbrevSlot {
+        uint32_t key = 0;     ///< pack3() of the abbreviation, 0 if empty
+        int8_t value = -1;    ///< Index into the source table
+    };
+
+    /**
+     * @brief Multiply-shift hash of a packed abbreviation into 2^Bits slots
+     */
+    template <int Bits>
+    constexpr uint32_t abbrev_hash(uint32_t key, uint32_t mul) noexcept {
+        return (key * mul) >> (32 - Bits);
+    }
+
+    /**
+     * @brief Build a perfect-hash table from a table of abbreviations
+     */
+    template <int Bits, size_t N>
+    constexpr std::array<AbbrevSlot, (size_t{1} << Bits)> make_abbrev_table(
+        const std::array<const char*, N>& names, uint32_t mul) noexcept {
+        std::array<AbbrevSlot, (size_t{1} << Bits)> table{};
+        for (size_t i = 0; i < N; ++i) {
+            uint32_t key = pack3(names[i]);
+            table[abbrev_hash<Bits>(key, mul)] = {key, static_cast<int8_t>(i)};
+        }
+        return table;
+    }
+
+    /**
+     * @brief Check that every abbreviation landed in its own slot
+     */
+    template <size_t N, size_t S>
+    constexpr bool is_perfect(const std::array<AbbrevSlot, S>& table) noexcept {
+        size_t used = 0;
+        for (const auto& slot : table) used += slot.value >= 0;
+        return used == N;
+    }
+
+    /**
+     * @brief 64-bit finalizer (MurmurHash3 fmix64) used by the std::hash specialisations
+     * @details Every input bit affects every output bit, so packed keys with
+     * mostly-constant high bits still spread over all buckets
+     */
+    constexpr uint64_t hash_mix(uint64_t x) noexcept {
+        x ^= x >> 33;
+        x *= 0xff51afd7ed558ccdull;
+        x ^= x >> 33;
+        x *= 0xc4ceb9fe1a85ec53ull;
+        x ^= x >> 33;
+        return x;
+    }
+
+    /// Floor of a / b for b > 0
+    constexpr int64_t floor_div(int64_t a, int64_t b) noexcept {
+        int64_t q = a / b;
+        return q - ((a % b) < 0);
+    }
+
+    constexpr uint32_t MONTH_HASH_MUL = 0xcf24cf6fu;
+    constexpr uint32_t WEEKDAY_HASH_MUL = 0xb337ff2du;
+    constexpr auto MONTH_ABBREV_TABLE = make_abbrev_table<4>(MONTH_ABBREV, MONTH_HASH_MUL);
+    constexpr auto WEEKDAY_ABBREV_TABLE = make_abbrev_table<3>(WEEKDAY_ABBREV, WEEKDAY_HASH_MUL);
+    static_assert(is_perfect<12>(MONTH_ABBREV_TABLE), "month hash collides");
+    static_assert(is_perfect<7>(WEEKDAY_ABBREV_TABLE), "weekday hash collides");
+
+    /**
+     * @brief Look up a month abbreviation ("Jan".."Dec", case-sensitive)
+     * @param s At least three readable characters
+     * @return Month [1-12], or 0 if s is not an abbreviation
+     * @note One multiply, one table load and one compare; no per-entry scan
+     */
+    constexpr int month_from_abbrev(const char* s) noexcept {
+        uint32_t key = pack3(s);
+        const AbbrevSlot& slot = MONTH_ABBREV_TABLE[abbrev_hash<4>(key, MONTH_HASH_MUL)];
+        return (slot.key == key) * (slot.value + 1);
+    }
+
+    /**
+     * @brief Look up a weekday abbreviation ("Mon".."Sun", case-sensitive)
+     * @param s At least three readable characters
+     * @return Day of week [0-6] (0=Monday), or -1 if s is not an abbreviation
+     */
+    constexpr int weekday_from_abbrev(const char* s) noexcept {
+        uint32_t key = pack3(s);
+        const AbbrevSlot& slot = WEEKDAY_ABBREV_TABLE[abbrev_hash<3>(key, WEEKDAY_HASH_MUL)];
+        return (slot.key == key) * (slot.value + 1) - 1;
+    }
+
+    /**
+     * @brief Overflow-checked signed 64-bit addition
+     * @return true if the result overflowed (out is then unspecified)
+     */
+    constexpr bool add_overflow(int64_t a, int64_t b, int64_t& out) noexcept {
+#if defined(__GNUC__) || defined(__clang__)
+        return __builtin_add_overflow(a, b, &out);
+#else
+        if ((b > 0 && a > INT64_MAX - b) || (b < 0 && a < INT64_MIN - b)) return true;
+        out = a + b;
+        return false;
+#endif
+    }
+
+    /**
+     * @brief Overflow-checked signed 64-bit subtraction
+     * @return true if the result overflowed (out is then unspecified)
+     */
+    constexpr bool sub_overflow(int64_t a, int64_t b, int64_t& out) noexcept {
+#if defined(__GNUC__) || defined(__clang__)
+        return __builtin_sub_overflow(a, b, &out);
+#else
+        if ((b < 0 && a > INT64_MAX + b) || (b > 0 && a < INT64_MIN + b)) return true;
+        out = a - b;
+        return false;
+#endif
+    }
+
+    /**
+     * @brief Overflow-checked signed 64-bit multiplication
+     * @return true if the result overflowed (out is then unspecified)
+     */
+    constexpr bool mul_overflow(int64_t a, int64_t b, int64_t& out) noexcept {
+#if defined(__GNUC__) || defined(__clang__)
+        return __builtin_mul_overflow(a, b, &out);
+#else
+        if (a == 0 || b == 0) { out = 0; return false; }
+        if ((a == -1 && b == INT64_MIN) || (b == -1 && a == INT64_MIN)) return true;
+        if (a > 0 ? (b > 0 ? a > INT64_MAX / b : b < INT64_MIN / a)
+                  : (b > 0 ? a < INT64_MIN / b : a < INT64_MAX / b)) return true;
+        out = a * b;
+        return false;
+#endif
+    }
+
     /**
      * @brief Fast integer division by 10
      */
@@ -132,6 +288,50 @@ namespace detail {
         str.append(buffer, 9);
     }
 
+    /**
+     * @brief Read two decimal digits
+     * @return Value [0-99], or -1 if either character is not a digit
+     */
+    constexpr int read_2digits(const char* s) noexcept {
+        unsigned a = static_cast<unsigned>(s[0]) - '0';
+        unsigned b = static_cast<unsigned>(s[1]) - '0';
+        return (a > 9 || b > 9) ? -1 : static_cast<int>(a * 10 + b);
+    }
+
+    /**
+     * @brief Read four decimal digits
+     * @return Value [0-9999], or -1 on a non-digit
+     */
+    constexpr int read_4digits(const char* s) noexcept {
+        int hi = read_2digits(s), lo = read_2digits(s + 2);
+        return (hi < 0 || lo < 0) ? -1 : hi * 100 + lo;
+    }
+
+    /**
+     * @brief Read "HH:MM:SS" (8 characters) and range-check it
+     * @note Second 60 passes through; callers settle it with fold_leap_second()
+     */
+    constexpr bool read_hms(const char* s, int& h, int& m, int& sec) noexcept {
+        h = read_2digits(s);
+        m = read_2digits(s + 3);
+        sec = read_2digits(s + 6);
+        if (s[2] != ':' || s[5] != ':' || h < 0 || m < 0 || sec < 0) return false;
+        return h < 24 && m < 60 && sec <= 60;
+    }
+
+    /**
+     * @brief Accept second 60 only at 23:59 UTC, where leap seconds occur, and read it as 59
+     * @param offset_minutes UTC offset of h:m, east positive (0 for UTC)
+     * @return false for second 60 at any other minute
+     */
+    constexpr bool fold_leap_second(int h, int m, int& sec, int32_t offset_minutes = 0) noexcept {
+        if (sec != 60) return true;
+        int32_t utc_minute = ((h * 60 + m - offset_minutes) % 1440 + 1440) % 1440;
+        if (utc_minute != 23 * 60 + 59) return false;
+        sec = 59;
+        return true;
+    }
+
 } // namespace detail
 
 // ============================================================================
@@ -169,6 +369,51 @@ constexpr int32_t days_since_epoch(int year) noexcept {
     return year * 365 + year / 4 - year / 100 + year / 400;
 }
 
+/**
+ * @brief Broken-down civil date produced by civil_from_days()
+ */
+struct CivilDate {
+    int year;   ///< Year
+    int month;  ///< Month [1-12]
+    int day;    ///< Day [1-31]
+};
+
+/**
+ * @brief Convert a civil date to days since the Unix epoch (1970-01-01)
+ * @param year Year (1-9999)
+ * @param month Month (1-12)
+ * @param day Day (1-31)
+ * @return Serial day number, negative before 1970-01-01
+ *
+ * @details Constant time (no loops), based on 400-year era arithmetic.
+ */
+constexpr int32_t days_from_civil(int year, int month, int day) noexcept {
+    const int y = year - (month <= 2 ? 1 : 0);
+    const int era = y / 400;  // y >= 0 for the supported range
+    const int yoe = y - era * 400;
+    const int doy = (153 * (month > 2 ? month - 3 : month + 9) + 2) / 5 + day - 1;
+    const int doe = yoe * 365 + yoe / 4 - yoe / 100 + doy;
+    return era * 146097 + doe - 719468;
+}
+
+/**
+ * @brief Convert days since the Unix epoch back to a civil date
+ * @param days Serial day number (see days_from_civil)
+ * @return Civil date; year is outside 1-9999 if days is out of range
+ */
+constexpr CivilDate civil_from_days(int32_t days) noexcept {
+    const int32_t z = days + 719468;
+    const int32_t era = (z >= 0 ? z : z - 146096) / 146097;
+    const int32_t doe = z - era * 146097;
+    const int32_t yoe = (doe - doe / 1460 + doe / 36524 - doe / 146096) / 365;
+    const int32_t doy = doe - (365 * yoe + yoe / 4 - yoe / 100);
+    const int32_t mp = (5 * doy + 2) / 153;
+    const int day = static_cast<int>(doy - (153 * mp + 2) / 5 + 1);
+    const int month = static_cast<int>(mp < 10 ? mp + 3 : mp - 9);
+    const int year = static_cast<int>(yoe + era * 400 + (month <= 2 ? 1 : 0));
+    return CivilDate{year, month, day};
+}
+
 /**
  * @brief Get number of days in a year
  * @param year The year to check
@@ -267,4 +512,30 @@ constexpr bool is_valid_time(int hour, int minute, int second, int nanosecond) n
            is_valid_second(second) && is_valid_nanosecond(nanosecond);
 }
 
+// ============================================================================
+// Unchecked Construction
+// ============================================================================
+
+/**
+ * @brief Tag type selecting constructors that skip validation
+ */
+struct unchecked_t {
+    explicit unchecked_t() = default;
+};
+
+/**
+ * @brief Tag for constructing from components already known to be valid
+ *
+ * @details
+ * Date(unchecked, y, m, d) and friends store their arguments without range
+ * checks, so they are noexcept and carry no throw path. Passing invalid
+ * components is a precondition violation: the object is safe to destroy
+ * but its accessors return unspecified values.
+ *
+ * @code
+ * if (zuu::is_valid_date(y, m, d)) dates.push_back(zuu::Date(zuu::unchecked, y, m, d));
+ * @endcode
+ */
+inline constexpr unchecked_t unchecked{};
+
 } // namespace zuu
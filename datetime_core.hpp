@@ -10,6 +10,9 @@
 
 #include "date_core.hpp"
 #include "time_core.hpp"
+#include "format_pattern.hpp"
+#include <optional>
+#include <stdexcept>
 
 namespace zuu {
 
@@ -61,6 +64,27 @@ public:
     constexpr DateTime(int year, int month, int day, 
                       int hour = 0, int minute = 0, int second = 0, int nanosecond = 0)
         : date_(year, month, day), time_(hour, minute, second, nanosecond) {}
+    
+    /**
+     * @brief Construct from components already known to be valid (no checks)
+     * @pre is_valid_date(year, month, day) && is_valid_time(hour, minute, second, nanosecond)
+     */
+    constexpr DateTime(unchecked_t, int year, int month, int day,
+                       int hour = 0, int minute = 0, int second = 0, int nanosecond = 0) noexcept
+        : date_(unchecked, year, month, day), time_(unchecked, hour, minute, second, nanosecond) {}
+    
+    /**
+     * @brief Construct from separate components without throwing
+     * @return DateTime, or std::nullopt if any component is invalid
+     */
+    [[nodiscard]] static constexpr std::optional<DateTime> try_make(int year, int month, int day,
+                                                                    int hour = 0, int minute = 0,
+                                                                    int second = 0, int nanosecond = 0) noexcept {
+        if (!is_valid_date(year, month, day) || !is_valid_time(hour, minute, second, nanosecond)) {
+            return std::nullopt;
+        }
+        return DateTime(unchecked, year, month, day, hour, minute, second, nanosecond);
+    }
 
     // ========================================================================
     // Component Accessors
@@ -97,6 +121,7 @@ public:
     [[nodiscard]] constexpr int day_of_week() const noexcept { return date_.day_of_week(); }
     [[nodiscard]] constexpr int day_of_year() const noexcept { return date_.day_of_year(); }
     [[nodiscard]] constexpr int quarter() const noexcept { return date_.quarter(); }
+    [[nodiscard]] constexpr int week_number() const noexcept { return date_.week_number(); }
     
     // Convenience accessors for time components
     [[nodiscard]] constexpr int hour() const noexcept { return time_.hour(); }
@@ -124,10 +149,7 @@ public:
      * @return DateTime object
      * @note Epoch is 1970-01-01 00:00:00 UTC
      */
-    [[nodiscard]] static DateTime from_unix_timestamp(int64_t seconds) noexcept {
-        // Unix epoch: 1970-01-01
-        Date epoch(1970, 1, 1);
-        
+    [[nodiscard]] static constexpr DateTime from_unix_timestamp(int64_t seconds) noexcept {
         int64_t days = seconds / detail::SECONDS_PER_DAY;
         int64_t remaining_seconds = seconds % detail::SECONDS_PER_DAY;
         
@@ -136,10 +158,102 @@ public:
             remaining_seconds += detail::SECONDS_PER_DAY;
         }
         
-        epoch.add_days(static_cast<int32_t>(days));
-        Time time = Time::from_seconds(remaining_seconds);
+        if (days < detail::MIN_UNIX_DAYS || days > detail::MAX_UNIX_DAYS) {
+            return DateTime();
+        }
+        return DateTime(Date::from_unix_days(static_cast<int32_t>(days)),
+                        Time::from_seconds(remaining_seconds));
+    }
+    
+    /**
+     * @brief Create DateTime from nanoseconds since the Unix epoch
+     * @param nanos Nanoseconds since 1970-01-01 00:00:00 UTC
+     * @return DateTime object
+     * @note An int64_t covers 1677-09-21 to 2262-04-11
+     */
+    [[nodiscard]] static constexpr DateTime from_unix_nanos(int64_t nanos) noexcept {
+        constexpr int64_t ns_per_day = static_cast<int64_t>(detail::NANOS_PER_DAY);
+        int64_t days = nanos / ns_per_day;
+        int64_t rem = nanos % ns_per_day;
+        if (rem < 0) {
+            days--;
+            rem += ns_per_day;
+        }
+        return DateTime(Date::from_unix_days(static_cast<int32_t>(days)),
+                        Time(unchecked, static_cast<uint64_t>(rem)));
+    }
+
+    // ========================================================================
+    // Parsing
+    // ========================================================================
+    
+    /**
+     * @brief Parse text produced by format() with a compiled pattern
+     * @param input Text to parse (must match the whole pattern)
+     * @param fmt Compiled format pattern
+     * @return Parsed DateTime, or std::nullopt on mismatch or invalid fields
+     *
+     * @details
+     * Accepts the same specifiers as format(). Fields missing from the
+     * pattern default to 0001-01-01 00:00:00. With %j but no %m/%d the date
+     * is taken from the day of year. %w, %a, %A, %q and %W carry no new
+     * information and are checked for consistency with the parsed date.
+     */
+    [[nodiscard]] static std::optional<DateTime> try_parse(std::string_view input, const FormatPattern& fmt) noexcept {
+        FormatPattern::Fields f;
+        if (!fmt.parse(input, f)) return std::nullopt;
+        
+        if (!f.has_month && !f.has_day && f.day_of_year != 0) {
+            if (!is_valid_year(f.year) || f.day_of_year > days_in_year(f.year)) return std::nullopt;
+            CivilDate c = civil_from_days(days_from_civil(f.year, 1, 1) + f.day_of_year - 1);
+            f.month = c.month;
+            f.day = c.day;
+        }
+        if (!is_valid_date(f.year, f.month, f.day) ||
+            !is_valid_time(f.hour, f.minute, f.second, f.nanosecond)) {
+            return std::nullopt;
+        }
         
-        return DateTime(epoch, time);
+        DateTime result(unchecked, f.year, f.month, f.day, f.hour, f.minute, f.second, f.nanosecond);
+        const Date& d = result.date_;
+        if ((f.day_of_year != 0 && f.day_of_year != d.day_of_year()) ||
+            (f.weekday >= 0 && f.weekday != d.day_of_week()) ||
+            (f.quarter != 0 && f.quarter != d.quarter()) ||
+            (f.week != 0 && f.week != d.week_number())) {
+            return std::nullopt;
+        }
+        return result;
+    }
+    
+    /**
+     * @brief Parse text using a format string
+     * @param input Text to parse
+     * @param fmt Format string (default: "%Y-%m-%d %H:%M:%S")
+     * @return Parsed DateTime, or std::nullopt on failure
+     * @note Compiles fmt on every call; prefer the FormatPattern overload in loops
+     */
+    [[nodiscard]] static std::optional<DateTime> try_parse(std::string_view input,
+                                                           std::string_view fmt = "%Y-%m-%d %H:%M:%S") {
+        return try_parse(input, FormatPattern(fmt));
+    }
+    
+    /**
+     * @brief Parse text with a compiled pattern
+     * @throw std::invalid_argument if input does not match or is not a valid datetime
+     */
+    [[nodiscard]] static DateTime parse(std::string_view input, const FormatPattern& fmt) {
+        if (auto result = try_parse(input, fmt)) return *result;
+        throw std::invalid_argument("Input does not match datetime format");
+    }
+    
+    /**
+     * @brief Parse text using a format string (inverse of format())
+     * @param input Text to parse
+     * @param fmt Format string (default: "%Y-%m-%d %H:%M:%S")
+     * @throw std::invalid_argument if input does not match or is not a valid datetime
+     */
+    [[nodiscard]] static DateTime parse(std::string_view input, std::string_view fmt = "%Y-%m-%d %H:%M:%S") {
+        return parse(input, FormatPattern(fmt));
     }
 
     // ========================================================================
@@ -194,7 +308,7 @@ public:
             total_secs %= detail::SECONDS_PER_DAY;
         } else if (total_secs < 0) {
             day_overflow = static_cast<int32_t>((total_secs - detail::SECONDS_PER_DAY + 1) / detail::SECONDS_PER_DAY);
-            total_secs -= day_overflow * detail::SECONDS_PER_DAY;
+            total_secs -= static_cast<int64_t>(day_overflow) * detail::SECONDS_PER_DAY;
         }
         
         // Update date if there's overflow
@@ -234,25 +348,7 @@ public:
      * @return Reference to this DateTime for chaining
      */
     constexpr DateTime& add_milliseconds(int64_t milliseconds) noexcept {
-        int64_t nanos = milliseconds * detail::NANOS_PER_MILLISECOND;
-        int64_t total_nanos = static_cast<int64_t>(time_.total_nanoseconds()) + nanos;
-        
-        // Calculate day overflow
-        int32_t day_overflow = 0;
-        if (total_nanos >= static_cast<int64_t>(detail::NANOS_PER_DAY)) {
-            day_overflow = static_cast<int32_t>(total_nanos / detail::NANOS_PER_DAY);
-            total_nanos %= detail::NANOS_PER_DAY;
-        } else if (total_nanos < 0) {
-            day_overflow = static_cast<int32_t>((total_nanos - detail::NANOS_PER_DAY + 1) / detail::NANOS_PER_DAY);
-            total_nanos -= day_overflow * detail::NANOS_PER_DAY;
-        }
-        
-        if (day_overflow != 0) {
-            date_.add_days(day_overflow);
-        }
-        
-        time_ = Time(static_cast<uint64_t>(total_nanos));
-        return *this;
+        return add_nanoseconds(milliseconds * detail::NANOS_PER_MILLISECOND);
     }
     
     /**
@@ -261,22 +357,25 @@ public:
      * @return Reference to this DateTime for chaining
      */
     constexpr DateTime& add_nanoseconds(int64_t nanoseconds) noexcept {
-        int64_t total_nanos = static_cast<int64_t>(time_.total_nanoseconds()) + nanoseconds;
+        constexpr int64_t ns_per_day = static_cast<int64_t>(detail::NANOS_PER_DAY);
         
-        int32_t day_overflow = 0;
-        if (total_nanos >= static_cast<int64_t>(detail::NANOS_PER_DAY)) {
-            day_overflow = static_cast<int32_t>(total_nanos / detail::NANOS_PER_DAY);
-            total_nanos %= detail::NANOS_PER_DAY;
+        // Split first so the sum below cannot overflow for any input
+        int64_t day_overflow = nanoseconds / ns_per_day;
+        int64_t total_nanos = static_cast<int64_t>(time_.total_nanoseconds()) + nanoseconds % ns_per_day;
+        
+        if (total_nanos >= ns_per_day) {
+            day_overflow++;
+            total_nanos -= ns_per_day;
         } else if (total_nanos < 0) {
-            day_overflow = static_cast<int32_t>((total_nanos - detail::NANOS_PER_DAY + 1) / detail::NANOS_PER_DAY);
-            total_nanos -= day_overflow * detail::NANOS_PER_DAY;
+            day_overflow--;
+            total_nanos += ns_per_day;
         }
         
         if (day_overflow != 0) {
-            date_.add_days(day_overflow);
+            date_.add_days(static_cast<int32_t>(day_overflow));
         }
         
-        time_ = Time(static_cast<uint64_t>(total_nanos));
+        time_ = Time(unchecked, static_cast<uint64_t>(total_nanos));
         return *this;
     }
     
@@ -325,6 +424,7 @@ public:
                         break;
                     }
                     case 'q': result += static_cast<char>('0' + quarter()); break;
+                    case 'W': detail::append_2digits(result, week_number()); break;
                     case 'B': result += detail::MONTH_NAMES[month() - 1]; break;
                     case 'b': result += detail::MONTH_ABBREV[month() - 1]; break;
                     case 'A': result += detail::WEEKDAY_NAMES[day_of_week()]; break;
@@ -402,15 +502,18 @@ public:
      * @brief Three-way comparison (C++20 spaceship operator)
      */
     [[nodiscard]] constexpr std::strong_ordering operator<=>(const DateTime& other) const noexcept {
-        if (auto cmp = date_ <=> other.date_; cmp != 0) return cmp;
-        return time_ <=> other.time_;
+        // Packed date (30 bits) and nanoseconds of day (47 bits) do not fit one
+        // 64-bit word, so this is two word compares
+        if (auto cmp = date_.packed() <=> other.date_.packed(); cmp != 0) return cmp;
+        return time_.total_nanoseconds() <=> other.time_.total_nanoseconds();
     }
     
     /**
      * @brief Equality comparison
      */
     [[nodiscard]] constexpr bool operator==(const DateTime& other) const noexcept {
-        return date_ == other.date_ && time_ == other.time_;
+        return ((date_.packed() ^ other.date_.packed()) |
+                (time_.total_nanoseconds() ^ other.time_.total_nanoseconds())) == 0;
     }
 
     // ========================================================================
@@ -422,9 +525,7 @@ public:
      * @return Unix timestamp in seconds
      */
     [[nodiscard]] constexpr int64_t to_unix_timestamp() const noexcept {
-        Date epoch(1970, 1, 1);
-        int32_t day_diff = date_.days_between(epoch);
-        return static_cast<int64_t>(day_diff) * detail::SECONDS_PER_DAY + time_.total_seconds();
+        return static_cast<int64_t>(date_.to_unix_days()) * detail::SECONDS_PER_DAY + time_.total_seconds();
     }
     
     /**
@@ -434,6 +535,57 @@ public:
     [[nodiscard]] constexpr int64_t to_unix_timestamp_ms() const noexcept {
         return to_unix_timestamp() * 1000 + millisecond();
     }
+    
+    /**
+     * @brief Convert to nanoseconds since the Unix epoch
+     * @return Unix timestamp in nanoseconds
+     * @note Only representable for 1677-09-21 to 2262-04-11
+     */
+    [[nodiscard]] constexpr int64_t to_unix_nanos() const noexcept {
+        return static_cast<int64_t>(date_.to_unix_days()) * static_cast<int64_t>(detail::NANOS_PER_DAY) +
+               static_cast<int64_t>(time_.total_nanoseconds());
+    }
+    
+    /**
+     * @brief Convert to std::chrono::sys_time with nanosecond precision
+     * @return Time point on the system clock (constant time)
+     * @note Only representable for 1677-09-21 to 2262-04-11
+     */
+    [[nodiscard]] constexpr std::chrono::sys_time<std::chrono::nanoseconds> to_sys_time() const noexcept {
+        return std::chrono::sys_time<std::chrono::nanoseconds>(std::chrono::nanoseconds(to_unix_nanos()));
+    }
+    
+    /**
+     * @brief Create DateTime from any std::chrono::sys_time
+     * @param tp Time point; sub-nanosecond precision is truncated toward the past
+     * @return DateTime object, or 0001-01-01 00:00:00 if out of range
+     *
+     * @details Splits tp into whole days and time of day before converting,
+     * so coarse time points (e.g. sys_seconds) work over the full 1-9999 range.
+     */
+    template <typename Dur>
+    [[nodiscard]] static constexpr DateTime from_sys_time(std::chrono::sys_time<Dur> tp) noexcept {
+        auto day = std::chrono::floor<std::chrono::days>(tp);
+        auto days = day.time_since_epoch().count();
+        if (days < detail::MIN_UNIX_DAYS || days > detail::MAX_UNIX_DAYS) {
+            return DateTime();
+        }
+        auto tod = std::chrono::floor<std::chrono::nanoseconds>(tp - day);
+        return DateTime(Date::from_unix_days(static_cast<int32_t>(days)),
+                        Time(unchecked, static_cast<uint64_t>(tod.count())));
+    }
+};
+
+} // namespace zuu
+
+/**
+ * @brief Hash for zuu::DateTime
+ */
+template <>
+struct std::hash<zuu::DateTime> {
+    [[nodiscard]] constexpr size_t operator()(const zuu::DateTime& dt) const noexcept {
+        return static_cast<size_t>(zuu::detail::hash_mix(
+            zuu::detail::hash_mix(dt.get_date().packed()) ^ dt.get_time().total_nanoseconds()));
+    }
 };
 
-} // namespace dt
@@ -0,0 +1,131 @@
+/**
+ * @file datetime_parallel.hpp
+ * @brief Minimal fork-join helpers for bulk datetime kernels
+ * @author zuudevs (zuudevs@gmail.com)
+ * @version 1.1.1
+ * @date 2026-10-16
+ */
+
+#pragma once
+
+#include <algorithm>
+#include <cstddef>
+#include <exception>
+#include <thread>
+#include <vector>
+
+namespace zuu {
+namespace detail {
+
+    /**
+     * @brief Number of workers worth spawning for a job
+     * @param n Number of elements
+     * @param min_per_worker Minimum elements a worker should receive
+     * @return Worker count in [1, hardware_concurrency]
+     */
+    inline size_t worker_count(size_t n, size_t min_per_worker) noexcept {
+        size_t hw = std::thread::hardware_concurrency();
+        if (hw == 0) hw = 1;
+        size_t by_size = min_per_worker ? n / min_per_worker : n;
+        return std::max<size_t>(1, std::min(hw, by_size));
+    }
+
+    /**
+     * @brief Joins every joinable thread on scope exit
+     */
+    struct JoinGuard {
+        std::vector<std::thread>& threads;
+
+        explicit JoinGuard(std::vector<std::thread>& t) noexcept : threads(t) {}
+        JoinGuard(const JoinGuard&) = delete;
+        JoinGuard& operator=(const JoinGuard&) = delete;
+
+        ~JoinGuard() {
+            for (auto& t : threads) {
+                if (t.joinable()) t.join();
+            }
+        }
+    };
+
+    /**
+     * @brief Split [0, n) into contiguous chunks and run them concurrently
+     * @param n Number of elements
+     * @param workers Number of chunks (the calling thread runs the last one)
+     * @param fn Callable invoked as fn(begin, end, chunk_index)
+     * @throw The exception of the lowest-numbered chunk that threw, after all
+     *        chunks have finished; std::system_error if a thread cannot start
+     *        (the chunks already started are joined first)
+     */
+    template <typename F>
+    void parallel_chunks(size_t n, size_t workers, F&& fn) {
+        if (workers <= 1 || n == 0) {
+            fn(size_t{0}, n, size_t{0});
+            return;
+        }
+        std::vector<std::exception_ptr> errors(workers);
+        auto run = [&fn, &errors](size_t b, size_t e, size_t w) noexcept {
+            try {
+                fn(b, e, w);
+            } catch (...) {
+                errors[w] = std::current_exception();
+            }
+        };
+        std::vector<std::thread> threads;
+        threads.reserve(workers - 1);
+        {
+            JoinGuard guard{threads};
+            size_t step = n / workers, extra = n % workers, pos = 0;
+            for (size_t w = 0; w < workers; ++w) {
+                size_t len = step + (w < extra ? 1 : 0);
+                if (w + 1 == workers) {
+                    run(pos, pos + len, w);
+                } else {
+                    threads.emplace_back(run, pos, pos + len, w);
+                }
+                pos += len;
+            }
+        }
+        for (auto& error : errors) {
+            if (error) std::rethrow_exception(error);
+        }
+    }
+
+    /**
+     * @brief Sort a random-access range using all hardware threads
+     * @param first Begin iterator
+     * @param last End iterator
+     * @param comp Strict weak ordering
+     *
+     * @details Chunks are sorted concurrently, then merged pairwise in
+     * parallel rounds with std::inplace_merge.
+     */
+    template <typename It, typename Compare>
+    void parallel_sort(It first, It last, Compare comp) {
+        size_t n = static_cast<size_t>(last - first);
+        size_t workers = worker_count(n, 1u << 16);
+        if (workers <= 1) {
+            std::sort(first, last, comp);
+            return;
+        }
+        std::vector<size_t> bounds(workers + 1, n);
+        parallel_chunks(n, workers, [&](size_t b, size_t e, size_t w) {
+            bounds[w] = b;
+            std::sort(first + b, first + e, comp);
+        });
+        while (bounds.size() > 2) {
+            size_t runs = bounds.size() - 1;
+            parallel_chunks(runs / 2, runs / 2, [&](size_t b, size_t e, size_t) {
+                for (size_t r = b; r < e; ++r) {
+                    std::inplace_merge(first + bounds[2 * r], first + bounds[2 * r + 1],
+                                       first + bounds[2 * r + 2], comp);
+                }
+            });
+            std::vector<size_t> next;
+            for (size_t r = 0; r < bounds.size(); r += 2) next.push_back(bounds[r]);
+            if (next.back() != n) next.push_back(n);
+            bounds = std::move(next);
+        }
+    }
+
+} // namespace detail
+} // namespace zuu
@@ -0,0 +1,270 @@
+/**
+ * @file datetime_sort.hpp
+ * @brief Parallel LSD radix sort for DateTime and epoch-nanosecond arrays
+ * @author zuudevs (zuudevs@gmail.com)
+ * @version 1.1.1
+ * @date 2026-10-16
+ */
+
+#pragma once
+
+#include "datetime_core.hpp"
+#include "datetime_parallel.hpp"
+#include <array>
+#include <span>
+#include <type_traits>
+
+namespace zuu {
+
+namespace detail {
+
+    constexpr int RADIX_BITS = 8;
+    constexpr size_t RADIX_BUCKETS = size_t{1} << RADIX_BITS;
+    constexpr int RADIX_PASSES = 64 / RADIX_BITS;
+
+    /**
+     * @brief Stable LSD radix sort of 64-bit keys with an optional payload
+     * @param keys Keys to sort (result ends up here)
+     * @param payload Payload moved alongside keys, or nullptr (P = void)
+     * @param n Number of elements
+     *
+     * @details
+     * One parallel pre-pass builds all eight byte histograms; byte positions
+     * where every key has the same value are skipped entirely. Each remaining
+     * pass runs a per-thread histogram of its chunk followed by a parallel
+     * scatter, so the sort stays stable.
+     */
+    template <typename P>
+    void radix_sort_u64(uint64_t* keys, P* payload, size_t n) {
+        constexpr bool has_payload = !std::is_void_v<P>;
+        if (n < 2) return;
+
+        using Hist = std::array<size_t, RADIX_BUCKETS>;
+        size_t workers = worker_count(n, 1u << 16);
+
+        // Global histograms of every byte position (order-independent)
+        std::vector<std::array<Hist, RADIX_PASSES>> pre(workers);
+        parallel_chunks(n, workers, [&](size_t b, size_t e, size_t w) {
+            auto& h = pre[w];
+            for (auto& row : h) row.fill(0);
+            for (size_t i = b; i < e; ++i) {
+                uint64_t k = keys[i];
+                for (int p = 0; p < RADIX_PASSES; ++p) {
+                    ++h[p][(k >> (p * RADIX_BITS)) & (RADIX_BUCKETS - 1)];
+                }
+            }
+        });
+        std::array<bool, RADIX_PASSES> skip{};
+        for (int p = 0; p < RADIX_PASSES; ++p) {
+            size_t first = (keys[0] >> (p * RADIX_BITS)) & (RADIX_BUCKETS - 1);
+            size_t total = 0;
+            for (size_t w = 0; w < workers; ++w) total += pre[w][p][first];
+            skip[p] = total == n;
+        }
+
+        std::vector<uint64_t> key_buf(n);
+        uint64_t* src = keys;
+        uint64_t* dst = key_buf.data();
+        std::conditional_t<has_payload, std::vector<P>, int> pay_buf{};
+        [[maybe_unused]] P* psrc = payload;
+        [[maybe_unused]] P* pdst = nullptr;
+        if constexpr (has_payload) {
+            pay_buf.resize(n);
+            pdst = pay_buf.data();
+        }
+
+        std::vector<Hist> offsets(workers);
+        for (int p = 0; p < RADIX_PASSES; ++p) {
+            if (skip[p]) continue;
+            int shift = p * RADIX_BITS;
+
+            parallel_chunks(n, workers, [&offsets, src, shift](size_t b, size_t e, size_t w) {
+                Hist& h = offsets[w];
+                h.fill(0);
+                for (size_t i = b; i < e; ++i) ++h[(src[i] >> shift) & (RADIX_BUCKETS - 1)];
+            });
+            size_t sum = 0;
+            for (size_t bucket = 0; bucket < RADIX_BUCKETS; ++bucket) {
+                for (size_t w = 0; w < workers; ++w) {
+                    size_t c = offsets[w][bucket];
+                    offsets[w][bucket] = sum;
+                    sum += c;
+                }
+            }
+            parallel_chunks(n, workers, [&offsets, src, dst, psrc, pdst, shift](size_t b, size_t e, size_t w) {
+                // Local copy keeps bucket cursors in cache and out of aliasing reach
+                Hist pos = offsets[w];
+                for (size_t i = b; i < e; ++i) {
+                    uint64_t k = src[i];
+                    size_t d = pos[(k >> shift) & (RADIX_BUCKETS - 1)]++;
+                    dst[d] = k;
+                    if constexpr (has_payload) pdst[d] = std::move(psrc[i]);
+                }
+            });
+            std::swap(src, dst);
+            if constexpr (has_payload) std::swap(psrc, pdst);
+        }
+
+        if (src != keys) {
+            std::copy(src, src + n, keys);
+            if constexpr (has_payload) std::move(psrc, psrc + n, payload);
+        }
+    }
+
+    /**
+     * @brief Order-preserving unsigned key for a signed 64-bit integer
+     */
+    constexpr uint64_t signed_key(int64_t v) noexcept {
+        return static_cast<uint64_t>(v) ^ (uint64_t{1} << 63);
+    }
+
+    /**
+     * @brief Serial day and nanosecond-of-day of a DateTime
+     */
+    constexpr int64_t datetime_days(const DateTime& v) noexcept { return v.get_date().to_unix_days(); }
+
+    /**
+     * @brief Largest day span whose (day, time) pairs fit one 64-bit key
+     */
+    constexpr int64_t MAX_KEY_DAY_SPAN = static_cast<int64_t>(UINT64_MAX / NANOS_PER_DAY) - 1;
+
+    /**
+     * @brief Build relative keys (day - base) * NANOS_PER_DAY + nanos_of_day
+     * @return false if the values span too many days for one 64-bit key
+     */
+    inline bool datetime_keys(std::span<const DateTime> values, std::vector<uint64_t>& keys, int64_t& base) {
+        if (values.empty()) return true;
+        int64_t lo = datetime_days(values[0]), hi = lo;
+        for (const auto& v : values) {
+            int64_t d = datetime_days(v);
+            lo = d < lo ? d : lo;
+            hi = d > hi ? d : hi;
+        }
+        if (hi - lo > MAX_KEY_DAY_SPAN) return false;
+        base = lo;
+        keys.resize(values.size());
+        for (size_t i = 0; i < values.size(); ++i) {
+            keys[i] = static_cast<uint64_t>(datetime_days(values[i]) - lo) * NANOS_PER_DAY +
+                      values[i].get_time().total_nanoseconds();
+        }
+        return true;
+    }
+
+} // namespace detail
+
+// ============================================================================
+// Sort Keys
+// ============================================================================
+
+/**
+ * @brief Order-preserving 64-bit key of a DateTime relative to a base day
+ * @param v Value to encode
+ * @param base_unix_days Serial day mapped to key 0 (must be <= v's day)
+ * @return (days since base) * NANOS_PER_DAY + nanoseconds of day
+ * @note Exact for values less than about 213,000 days (584 years) after the base
+ */
+[[nodiscard]] constexpr uint64_t sort_key(const DateTime& v, int32_t base_unix_days) noexcept {
+    return static_cast<uint64_t>(detail::datetime_days(v) - base_unix_days) * detail::NANOS_PER_DAY +
+           v.get_time().total_nanoseconds();
+}
+
+/**
+ * @brief Inverse of sort_key()
+ */
+[[nodiscard]] constexpr DateTime from_sort_key(uint64_t key, int32_t base_unix_days) noexcept {
+    return DateTime(Date::from_unix_days(static_cast<int32_t>(base_unix_days + key / detail::NANOS_PER_DAY)),
+                    Time(unchecked, key % detail::NANOS_PER_DAY));
+}
+
+// ============================================================================
+// Radix Sort
+// ============================================================================
+
+/**
+ * @brief Sort epoch-nanosecond timestamps ascending (parallel LSD radix sort)
+ * @param values Unix nanoseconds, sorted in place
+ */
+inline void radix_sort(std::span<int64_t> values) {
+    // Flipping the sign bit in place turns int64 order into uint64 order
+    uint64_t* keys = reinterpret_cast<uint64_t*>(values.data());
+    for (auto& k : std::span<uint64_t>(keys, values.size())) k ^= uint64_t{1} << 63;
+    detail::radix_sort_u64<void>(keys, nullptr, values.size());
+    for (auto& k : std::span<uint64_t>(keys, values.size())) k ^= uint64_t{1} << 63;
+}
+
+/**
+ * @brief Sort DateTime values ascending (parallel LSD radix sort)
+ * @param values Datetimes, sorted in place
+ *
+ * @details Values are mapped to sort_key() relative to the earliest day in
+ * the span. Only the keys are sorted; datetimes are rebuilt from them, so a
+ * pass moves 8 bytes per element. Data covering one day keeps its high
+ * bytes constant and needs only the passes over the nanosecond-of-day bytes.
+ * Spans wider than about 584 years fall back to a two-stage radix sort
+ * (nanosecond of day, then day).
+ */
+inline void radix_sort(std::span<DateTime> values) {
+    std::vector<uint64_t> keys;
+    int64_t base = 0;
+    if (detail::datetime_keys(values, keys, base)) {
+        detail::radix_sort_u64<void>(keys.data(), nullptr, keys.size());
+        for (size_t i = 0; i < values.size(); ++i) {
+            values[i] = from_sort_key(keys[i], static_cast<int32_t>(base));
+        }
+        return;
+    }
+
+    // Wide range: stable LSD on time of day, then on day number
+    keys.resize(values.size());
+    std::vector<DateTime> tmp(values.begin(), values.end());
+    for (size_t i = 0; i < tmp.size(); ++i) keys[i] = tmp[i].get_time().total_nanoseconds();
+    detail::radix_sort_u64(keys.data(), tmp.data(), tmp.size());
+    for (size_t i = 0; i < tmp.size(); ++i) keys[i] = detail::signed_key(detail::datetime_days(tmp[i]));
+    detail::radix_sort_u64(keys.data(), tmp.data(), tmp.size());
+    std::copy(tmp.begin(), tmp.end(), values.begin());
+}
+
+/**
+ * @brief Sort DateTime keys ascending together with a payload (stable)
+ * @param keys Datetimes, sorted in place
+ * @param payload Values reordered alongside keys (same length)
+ */
+template <typename P>
+void radix_sort(std::span<DateTime> keys, std::span<P> payload) {
+    size_t n = std::min(keys.size(), payload.size());
+    std::vector<uint64_t> k;
+    int64_t base = 0;
+    if (detail::datetime_keys(keys.first(n), k, base)) {
+        detail::radix_sort_u64(k.data(), payload.data(), n);
+        for (size_t i = 0; i < n; ++i) keys[i] = from_sort_key(k[i], static_cast<int32_t>(base));
+        return;
+    }
+
+    std::vector<std::pair<DateTime, P>> tmp(n);
+    for (size_t i = 0; i < n; ++i) tmp[i] = {keys[i], std::move(payload[i])};
+    k.resize(n);
+    for (size_t i = 0; i < n; ++i) k[i] = tmp[i].first.get_time().total_nanoseconds();
+    detail::radix_sort_u64(k.data(), tmp.data(), n);
+    for (size_t i = 0; i < n; ++i) k[i] = detail::signed_key(detail::datetime_days(tmp[i].first));
+    detail::radix_sort_u64(k.data(), tmp.data(), n);
+    for (size_t i = 0; i < n; ++i) {
+        keys[i] = tmp[i].first;
+        payload[i] = std::move(tmp[i].second);
+    }
+}
+
+/**
+ * @brief Sort epoch-nanosecond keys ascending together with a payload (stable)
+ * @param keys Unix nanoseconds, sorted in place
+ * @param payload Values reordered alongside keys (same length)
+ */
+template <typename P>
+void radix_sort(std::span<int64_t> keys, std::span<P> payload) {
+    size_t n = std::min(keys.size(), payload.size());
+    uint64_t* k = reinterpret_cast<uint64_t*>(keys.data());
+    for (size_t i = 0; i < n; ++i) k[i] ^= uint64_t{1} << 63;
+    detail::radix_sort_u64(k, payload.data(), n);
+    for (size_t i = 0; i < n; ++i) k[i] ^= uint64_t{1} << 63;
+}
+
+} // namespace zuu
@@ -0,0 +1,443 @@
+/**
+ * @file duration_core.hpp
+ * @brief Signed nanosecond duration with overflow-checked arithmetic
+ * @author zuudevs (zuudevs@gmail.com)
+ * @version 1.1.1
+ * @date 2026-10-16
+ */
+
+#pragma once
+
+#include "datetime_core.hpp"
+#include <limits>
+#include <optional>
+#include <stdexcept>
+
+namespace zuu {
+
+/**
+ * @class Duration
+ * @brief Signed span of time with nanosecond precision
+ *
+ * @details
+ * Stores a signed 64-bit nanosecond count (about +/-292 years).
+ * Memory: 8 bytes
+ *
+ * Arithmetic comes in three flavours:
+ * - Operators (+, -, *, /) throw std::overflow_error on overflow, which
+ *   makes overflow a compile error in constant expressions
+ * - checked_*() return std::nullopt on overflow
+ * - saturating_*() clamp to min()/max()
+ */
+class Duration {
+private:
+    int64_t nanos_ = 0;   ///< Signed nanosecond count
+
+    [[nodiscard]] static constexpr Duration scaled(int64_t count, int64_t unit) {
+        int64_t out = 0;
+        if (detail::mul_overflow(count, unit, out)) {
+            throw std::overflow_error("Duration overflow");
+        }
+        return Duration(out);
+    }
+
+public:
+    /**
+     * @brief Default constructor - creates a zero duration
+     */
+    constexpr Duration() noexcept = default;
+
+    /**
+     * @brief Construct from a nanosecond count
+     * @param nanos Signed nanoseconds
+     */
+    constexpr explicit Duration(int64_t nanos) noexcept : nanos_(nanos) {}
+
+    // ========================================================================
+    // Static Factory Methods
+    // ========================================================================
+
+    [[nodiscard]] static constexpr Duration zero() noexcept { return Duration(); }
+    [[nodiscard]] static constexpr Duration min() noexcept { return Duration(std::numeric_limits<int64_t>::min()); }
+    [[nodiscard]] static constexpr Duration max() noexcept { return Duration(std::numeric_limits<int64_t>::max()); }
+
+    [[nodiscard]] static constexpr Duration from_nanoseconds(int64_t n) noexcept { return Duration(n); }
+    [[nodiscard]] static constexpr Duration from_microseconds(int64_t n) { return scaled(n, detail::NANOS_PER_MICROSECOND); }
+    [[nodiscard]] static constexpr Duration from_milliseconds(int64_t n) { return scaled(n, detail::NANOS_PER_MILLISECOND); }
+    [[nodiscard]] static constexpr Duration from_seconds(int64_t n) { return scaled(n, detail::NANOS_PER_SECOND); }
+    [[nodiscard]] static constexpr Duration from_minutes(int64_t n) { return scaled(n, detail::NANOS_PER_MINUTE); }
+    [[nodiscard]] static constexpr Duration from_hours(int64_t n) { return scaled(n, detail::NANOS_PER_HOUR); }
+    [[nodiscard]] static constexpr Duration from_days(int64_t n) { return scaled(n, detail::NANOS_PER_DAY); }
+
+    /**
+     * @brief Create from any std::chrono::duration (truncates toward zero)
+     * @throw std::overflow_error if d does not fit in int64 nanoseconds
+     */
+    template <typename Rep, typename Ratio>
+    [[nodiscard]] static constexpr Duration from_chrono(std::chrono::duration<Rep, Ratio> d) {
+        using wide = std::chrono::duration<long double, std::nano>;
+        wide w = d;
+        if (w.count() >= 9.2233720368547758e18L || w.count() < -9.2233720368547758e18L) {
+            throw std::overflow_error("Duration overflow");
+        }
+        return Duration(std::chrono::duration_cast<std::chrono::nanoseconds>(d).count());
+    }
+
+    /**
+     * @brief Convert to std::chrono::nanoseconds
+     */
+    [[nodiscard]] constexpr std::chrono::nanoseconds to_chrono() const noexcept {
+        return std::chrono::nanoseconds(nanos_);
+    }
+
+    // ========================================================================
+    // Total Value Accessors (truncate toward zero)
+    // ========================================================================
+
+    [[nodiscard]] constexpr int64_t total_nanoseconds() const noexcept { return nanos_; }
+    [[nodiscard]] constexpr int64_t total_microseconds() const noexcept { return nanos_ / detail::NANOS_PER_MICROSECOND; }
+    [[nodiscard]] constexpr int64_t total_milliseconds() const noexcept { return nanos_ / detail::NANOS_PER_MILLISECOND; }
+    [[nodiscard]] constexpr int64_t total_seconds() const noexcept { return nanos_ / detail::NANOS_PER_SECOND; }
+    [[nodiscard]] constexpr int64_t total_minutes() const noexcept { return nanos_ / static_cast<int64_t>(detail::NANOS_PER_MINUTE); }
+    [[nodiscard]] constexpr int64_t total_hours() const noexcept { return nanos_ / static_cast<int64_t>(detail::NANOS_PER_HOUR); }
+    [[nodiscard]] constexpr int64_t total_days() const noexcept { return nanos_ / static_cast<int64_t>(detail::NANOS_PER_DAY); }
+
+    /**
+     * @brief Check if duration is zero
+     */
+    [[nodiscard]] constexpr bool is_zero() const noexcept { return nanos_ == 0; }
+
+    /**
+     * @brief Check if duration is negative
+     */
+    [[nodiscard]] constexpr bool is_negative() const noexcept { return nanos_ < 0; }
+
+    /**
+     * @brief Absolute value
+     * @throw std::overflow_error for min()
+     */
+    [[nodiscard]] constexpr Duration abs() const {
+        return nanos_ < 0 ? -*this : *this;
+    }
+
+    // ========================================================================
+    // Checked Arithmetic (std::nullopt on overflow)
+    // ========================================================================
+
+    [[nodiscard]] constexpr std::optional<Duration> checked_add(Duration other) const noexcept {
+        int64_t out = 0;
+        if (detail::add_overflow(nanos_, other.nanos_, out)) return std::nullopt;
+        return Duration(out);
+    }
+
+    [[nodiscard]] constexpr std::optional<Duration> checked_sub(Duration other) const noexcept {
+        int64_t out = 0;
+        if (detail::sub_overflow(nanos_, other.nanos_, out)) return std::nullopt;
+        return Duration(out);
+    }
+
+    [[nodiscard]] constexpr std::optional<Duration> checked_mul(int64_t factor) const noexcept {
+        int64_t out = 0;
+        if (detail::mul_overflow(nanos_, factor, out)) return std::nullopt;
+        return Duration(out);
+    }
+
+    [[nodiscard]] constexpr std::optional<Duration> checked_div(int64_t divisor) const noexcept {
+        if (divisor == 0 || (divisor == -1 && nanos_ == std::numeric_limits<int64_t>::min())) {
+            return std::nullopt;
+        }
+        return Duration(nanos_ / divisor);
+    }
+
+    // ========================================================================
+    // Saturating Arithmetic (clamps to min()/max())
+    // ========================================================================
+
+    [[nodiscard]] constexpr Duration saturating_add(Duration other) const noexcept {
+        int64_t out = 0;
+        if (detail::add_overflow(nanos_, other.nanos_, out)) return other.nanos_ < 0 ? min() : max();
+        return Duration(out);
+    }
+
+    [[nodiscard]] constexpr Duration saturating_sub(Duration other) const noexcept {
+        int64_t out = 0;
+        if (detail::sub_overflow(nanos_, other.nanos_, out)) return other.nanos_ > 0 ? min() : max();
+        return Duration(out);
+    }
+
+    [[nodiscard]] constexpr Duration saturating_mul(int64_t factor) const noexcept {
+        int64_t out = 0;
+        if (detail::mul_overflow(nanos_, factor, out)) return (nanos_ < 0) != (factor < 0) ? min() : max();
+        return Duration(out);
+    }
+
+    // ========================================================================
+    // Operators (throw std::overflow_error on overflow)
+    // ========================================================================
+
+    [[nodiscard]] constexpr Duration operator-() const {
+        if (nanos_ == std::numeric_limits<int64_t>::min()) throw std::overflow_error("Duration overflow");
+        return Duration(-nanos_);
+    }
+
+    [[nodiscard]] constexpr Duration operator+(Duration other) const {
+        if (auto r = checked_add(other)) return *r;
+        throw std::overflow_error("Duration overflow");
+    }
+
+    [[nodiscard]] constexpr Duration operator-(Duration other) const {
+        if (auto r = checked_sub(other)) return *r;
+        throw std::overflow_error("Duration overflow");
+    }
+
+    [[nodiscard]] constexpr Duration operator*(int64_t factor) const {
+        if (auto r = checked_mul(factor)) return *r;
+        throw std::overflow_error("Duration overflow");
+    }
+
+    [[nodiscard]] constexpr Duration operator/(int64_t divisor) const {
+        if (auto r = checked_div(divisor)) return *r;
+        throw std::overflow_error("Duration division overflow");
+    }
+
+    /**
+     * @brief Ratio of two durations (truncates toward zero)
+     */
+    [[nodiscard]] constexpr int64_t operator/(Duration other) const {
+        if (other.nanos_ == 0 || (other.nanos_ == -1 && nanos_ == std::numeric_limits<int64_t>::min())) {
+            throw std::overflow_error("Duration division overflow");
+        }
+        return nanos_ / other.nanos_;
+    }
+
+    /**
+     * @brief Remainder of division by another duration
+     */
+    [[nodiscard]] constexpr Duration operator%(Duration other) const {
+        if (other.nanos_ == 0) throw std::overflow_error("Duration division overflow");
+        if (other.nanos_ == -1) return Duration();
+        return Duration(nanos_ % other.nanos_);
+    }
+
+    constexpr Duration& operator+=(Duration other) { return *this = *this + other; }
+    constexpr Duration& operator-=(Duration other) { return *this = *this - other; }
+    constexpr Duration& operator*=(int64_t factor) { return *this = *this * factor; }
+    constexpr Duration& operator/=(int64_t divisor) { return *this = *this / divisor; }
+
+    [[nodiscard]] friend constexpr Duration operator*(int64_t factor, Duration d) { return d * factor; }
+
+    // ========================================================================
+    // Comparison Operators
+    // ========================================================================
+
+    [[nodiscard]] constexpr std::strong_ordering operator<=>(const Duration& other) const noexcept = default;
+    [[nodiscard]] constexpr bool operator==(const Duration& other) const noexcept = default;
+
+    // ========================================================================
+    // ISO 8601 Formatting and Parsing
+    // ========================================================================
+
+    /**
+     * @brief Maximum length written by write_iso8601()
+     */
+    static constexpr size_t ISO8601_MAX_LENGTH = 32;
+
+    /**
+     * @brief Write ISO 8601 duration ("PT1H30M", "PT0.25S", "-PT36H") without allocating
+     * @param out Buffer of at least ISO8601_MAX_LENGTH bytes
+     * @return Number of characters written
+     *
+     * @details Hours are not folded into days, since a day is not a fixed
+     * length in calendar arithmetic. Fractional seconds drop trailing zeros.
+     */
+    constexpr size_t write_iso8601(char* out) const noexcept {
+        char* p = out;
+        uint64_t mag = nanos_ < 0 ? uint64_t{0} - static_cast<uint64_t>(nanos_) : static_cast<uint64_t>(nanos_);
+        if (nanos_ < 0) *p++ = '-';
+        *p++ = 'P';
+        *p++ = 'T';
+
+        auto put_uint = [&p](uint64_t v) {
+            char buf[20];
+            int n = 0;
+            do { buf[n++] = static_cast<char>('0' + v % 10); v /= 10; } while (v);
+            while (n) *p++ = buf[--n];
+        };
+
+        uint64_t hours = mag / detail::NANOS_PER_HOUR;
+        uint64_t minutes = (mag % detail::NANOS_PER_HOUR) / detail::NANOS_PER_MINUTE;
+        uint64_t seconds = (mag % detail::NANOS_PER_MINUTE) / detail::NANOS_PER_SECOND;
+        uint32_t frac = static_cast<uint32_t>(mag % detail::NANOS_PER_SECOND);
+
+        if (hours) { put_uint(hours); *p++ = 'H'; }
+        if (minutes) { put_uint(minutes); *p++ = 'M'; }
+        if (seconds || frac || (!hours && !minutes)) {
+            put_uint(seconds);
+            if (frac) {
+                *p++ = '.';
+                int digits = 9;
+                while (frac % 10 == 0) { frac /= 10; --digits; }
+                for (int i = digits - 1; i >= 0; --i) {
+                    p[i] = static_cast<char>('0' + frac % 10);
+                    frac /= 10;
+                }
+                p += digits;
+            }
+            *p++ = 'S';
+        }
+        return static_cast<size_t>(p - out);
+    }
+
+    /**
+     * @brief Format as ISO 8601 duration
+     * @return String such as "PT1H30M" or "-PT0.000001S"
+     */
+    [[nodiscard]] std::string to_iso8601() const {
+        char buf[ISO8601_MAX_LENGTH];
+        return std::string(buf, write_iso8601(buf));
+    }
+
+    /**
+     * @brief Parse an ISO 8601 duration
+     * @param text Input such as "PT1H30M", "P2DT3H", "P1W", "-PT0.5S"
+     * @return Parsed duration, or std::nullopt if malformed or out of range
+     *
+     * @details Accepts weeks (W) and days (D) as exact multiples of 24 hours;
+     * years and months are rejected because their length is not fixed. A
+     * fraction ('.' or ',') is allowed on the seconds component only.
+     */
+    [[nodiscard]] static constexpr std::optional<Duration> parse_iso8601(std::string_view text) noexcept {
+        size_t i = 0, n = text.size();
+        bool negative = false;
+        if (i < n && (text[i] == '-' || text[i] == '+')) negative = text[i++] == '-';
+        if (i >= n || text[i] != 'P') return std::nullopt;
+        ++i;
+
+        int64_t total = 0;
+        bool in_time = false, any = false;
+        int last_rank = -1;   // enforces W/D/H/M/S order
+        while (i < n) {
+            if (text[i] == 'T') {
+                if (in_time) return std::nullopt;
+                in_time = true;
+                ++i;
+                continue;
+            }
+            int64_t value = 0;
+            size_t start = i;
+            while (i < n && text[i] >= '0' && text[i] <= '9') {
+                if (detail::mul_overflow(value, 10, value) ||
+                    detail::add_overflow(value, text[i] - '0', value)) return std::nullopt;
+                ++i;
+            }
+            if (i == start || i >= n) return std::nullopt;
+
+            int64_t frac = 0;
+            if (text[i] == '.' || text[i] == ',') {
+                ++i;
+                int digits = 0;
+                size_t fstart = i;
+                while (i < n && text[i] >= '0' && text[i] <= '9') {
+                    if (digits < 9) { frac = frac * 10 + (text[i] - '0'); ++digits; }
+                    ++i;
+                }
+                if (i == fstart || i >= n || text[i] != 'S') return std::nullopt;
+                for (; digits < 9; ++digits) frac *= 10;
+            }
+
+            int rank = 0;
+            int64_t unit = 0;
+            switch (text[i]) {
+                case 'W': rank = 0; unit = 7 * static_cast<int64_t>(detail::NANOS_PER_DAY); break;
+                case 'D': rank = 1; unit = static_cast<int64_t>(detail::NANOS_PER_DAY); break;
+                case 'H': rank = 2; unit = static_cast<int64_t>(detail::NANOS_PER_HOUR); break;
+                case 'M': rank = 3; unit = static_cast<int64_t>(detail::NANOS_PER_MINUTE); break;
+                case 'S': rank = 4; unit = detail::NANOS_PER_SECOND; break;
+                default: return std::nullopt;
+            }
+            if ((rank >= 2) != in_time || rank <= last_rank) return std::nullopt;
+            last_rank = rank;
+            ++i;
+
+            // Accumulate with the sign applied so min() parses back
+            if (negative) { value = -value; frac = -frac; }
+            int64_t part = 0;
+            if (detail::mul_overflow(value, unit, part) ||
+                detail::add_overflow(part, frac, part) ||
+                detail::add_overflow(total, part, total)) return std::nullopt;
+            any = true;
+        }
+        if (!any || (in_time && last_rank < 2)) return std::nullopt;
+        return Duration(total);
+    }
+};
+
+// ============================================================================
+// DateTime / Duration Arithmetic
+// ============================================================================
+
+/**
+ * @brief Exact difference between two datetimes
+ * @return Difference, or std::nullopt if it exceeds the Duration range
+ */
+[[nodiscard]] constexpr std::optional<Duration> checked_difference(const DateTime& a, const DateTime& b) noexcept {
+    int64_t days = a.get_date().days_between(b.get_date());
+    int64_t nanos = static_cast<int64_t>(a.get_time().total_nanoseconds()) -
+                    static_cast<int64_t>(b.get_time().total_nanoseconds());
+    // Give both parts the same sign so days * NANOS_PER_DAY overflows only
+    // when the result does
+    constexpr int64_t ns_per_day = static_cast<int64_t>(detail::NANOS_PER_DAY);
+    if (days < 0 && nanos > 0) { ++days; nanos -= ns_per_day; }
+    else if (days > 0 && nanos < 0) { --days; nanos += ns_per_day; }
+    int64_t out = 0;
+    if (detail::mul_overflow(days, ns_per_day, out) ||
+        detail::add_overflow(out, nanos, out)) return std::nullopt;
+    return Duration(out);
+}
+
+/**
+ * @brief Exact difference between two datetimes, including nanoseconds
+ * @throw std::overflow_error if the gap exceeds about 292 years
+ */
+[[nodiscard]] constexpr Duration operator-(const DateTime& a, const DateTime& b) {
+    if (auto d = checked_difference(a, b)) return *d;
+    throw std::overflow_error("Duration overflow");
+}
+
+/**
+ * @brief Shift a datetime forward by a duration
+ * @note As with DateTime::add_nanoseconds(), a date step outside 0001..9999
+ * leaves the date unchanged while the time of day still moves
+ */
+[[nodiscard]] constexpr DateTime operator+(DateTime dt, Duration d) noexcept {
+    return dt.add_nanoseconds(d.total_nanoseconds());
+}
+
+/**
+ * @brief Shift a datetime backward by a duration
+ * @note Subtracting min() shifts forward by 2^63 nanoseconds
+ */
+[[nodiscard]] constexpr DateTime operator-(DateTime dt, Duration d) noexcept {
+    int64_t n = d.total_nanoseconds();
+    if (n == std::numeric_limits<int64_t>::min()) {
+        dt.add_nanoseconds(std::numeric_limits<int64_t>::max());
+        return dt.add_nanoseconds(1);
+    }
+    return dt.add_nanoseconds(-n);
+}
+
+constexpr DateTime& operator+=(DateTime& dt, Duration d) noexcept { return dt = dt + d; }
+constexpr DateTime& operator-=(DateTime& dt, Duration d) noexcept { return dt = dt - d; }
+
+} // namespace zuu
+
+/**
+ * @brief Hash for zuu::Duration
+ */
+template <>
+struct std::hash<zuu::Duration> {
+    [[nodiscard]] constexpr size_t operator()(const zuu::Duration& d) const noexcept {
+        return static_cast<size_t>(zuu::detail::hash_mix(static_cast<uint64_t>(d.total_nanoseconds())));
+    }
+};
+
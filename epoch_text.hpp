@@ -0,0 +1,340 @@
+/**
+ * @file epoch_text.hpp
+ * @brief Decimal epoch timestamps: parsing with unit detection, fixed-point writing
+ * @author zuudevs (zuudevs@gmail.com)
+ * @version 1.1.1
+ * @date 2026-10-16
+ */
+
+#pragma once
+
+#include "datetime_core.hpp"
+#include "datetime_parallel.hpp"
+#include <bit>
+#include <optional>
+#include <span>
+#include <string>
+#include <string_view>
+
+namespace zuu {
+
+/**
+ * @brief Unit of a decimal epoch timestamp
+ */
+enum class EpochUnit : uint8_t {
+    Seconds,        ///< 1700000000
+    Milliseconds,   ///< 1700000000123
+    Microseconds,   ///< 1700000000123456
+    Nanoseconds     ///< 1700000000123456789
+};
+
+/**
+ * @brief Maximum length written by write_epoch() ("-" + 19 digits + "." + 9 digits)
+ */
+constexpr size_t EPOCH_MAX_LENGTH = 32;
+
+/**
+ * @brief Value stored by the batch parser for entries that fail to parse
+ */
+constexpr int64_t EPOCH_PARSE_ERROR = INT64_MIN;
+
+namespace detail {
+
+    constexpr uint64_t SWAR_ONES = 0x0101010101010101ULL;
+
+    /// Nanoseconds per unit, indexed by EpochUnit
+    constexpr std::array<int64_t, 4> EPOCH_UNIT_SCALE = {1'000'000'000, 1'000'000, 1'000, 1};
+
+    /// 10^0 .. 10^9
+    constexpr std::array<uint32_t, 10> POW10 = {
+        1, 10, 100, 1'000, 10'000, 100'000, 1'000'000, 10'000'000, 100'000'000, 1'000'000'000
+    };
+
+    /// Little-endian load of 8 characters
+    constexpr uint64_t load8(const char* p) noexcept {
+        uint64_t v = 0;
+        for (int i = 0; i < 8; ++i) {
+            v |= static_cast<uint64_t>(static_cast<unsigned char>(p[i])) << (8 * i);
+        }
+        return v;
+    }
+
+    /**
+     * @brief Number of leading decimal digits in 8 packed characters [0-8]
+     * @details A borrow or carry can only leave a byte that is itself not a
+     * digit, so the lowest flagged byte is exact.
+     */
+    constexpr int leading_digits8(uint64_t v) noexcept {
+        uint64_t below = v - 0x30 * SWAR_ONES;
+        uint64_t above = v + 0x46 * SWAR_ONES;
+        uint64_t flags = (below | above) & (0x80 * SWAR_ONES);
+        return flags ? std::countr_zero(flags) / 8 : 8;
+    }
+
+    /// Value of 8 packed digit characters (most significant first)
+    constexpr uint32_t parse8(uint64_t v) noexcept {
+        v -= 0x30 * SWAR_ONES;
+        v = v * 10 + (v >> 8);
+        v = (((v & 0x000000FF000000FFULL) * (100 + (1000000ULL << 32))) +
+             (((v >> 16) & 0x000000FF000000FFULL) * (1 + (10000ULL << 32)))) >> 32;
+        return static_cast<uint32_t>(v);
+    }
+
+    /**
+     * @brief Accumulate a run of digits, eight at a time where possible
+     * @param p Cursor, advanced past every digit of the run
+     * @param keep Maximum digits folded into value; later digits are skipped
+     * @return Number of digits in the run
+     */
+    constexpr size_t read_digit_run(const char*& p, const char* end, uint64_t& value, size_t keep) noexcept {
+        size_t count = 0;
+        while (end - p >= 8) {
+            uint64_t v = load8(p);
+            int n = leading_digits8(v);
+            if (n == 8 && count + 8 <= keep) {
+                value = value * 100'000'000 + parse8(v);
+                count += 8;
+                p += 8;
+                continue;
+            }
+            if (n < 8) {
+                for (int i = 0; i < n; ++i, ++count) {
+                    if (count < keep) value = value * 10 + static_cast<uint64_t>(p[i] - '0');
+                }
+                p += n;
+                return count;
+            }
+            break;
+        }
+        for (; p != end && static_cast<unsigned>(*p) - '0' <= 9; ++p, ++count) {
+            if (count < keep) value = value * 10 + static_cast<uint64_t>(*p - '0');
+        }
+        return count;
+    }
+
+    /// Unit implied by the number of integer digits
+    constexpr EpochUnit unit_for_digits(size_t digits) noexcept {
+        return digits <= 10 ? EpochUnit::Seconds
+             : digits <= 13 ? EpochUnit::Milliseconds
+             : digits <= 16 ? EpochUnit::Microseconds
+             : EpochUnit::Nanoseconds;
+    }
+
+    /// Digit pairs "00".."99"
+    constexpr std::array<char, 200> DIGIT_PAIRS = [] {
+        std::array<char, 200> t{};
+        for (int i = 0; i < 100; ++i) {
+            t[2 * i] = static_cast<char>('0' + i / 10);
+            t[2 * i + 1] = static_cast<char>('0' + i % 10);
+        }
+        return t;
+    }();
+
+    /// Write an unsigned integer without padding, returns the end pointer
+    constexpr char* write_u64(char* out, uint64_t v) noexcept {
+        char buf[20];
+        char* p = buf + 20;
+        while (v >= 100) {
+            size_t pair = static_cast<size_t>(v % 100) * 2;
+            v /= 100;
+            *--p = DIGIT_PAIRS[pair + 1];
+            *--p = DIGIT_PAIRS[pair];
+        }
+        if (v >= 10) {
+            *--p = DIGIT_PAIRS[v * 2 + 1];
+            *--p = DIGIT_PAIRS[v * 2];
+        } else {
+            *--p = static_cast<char>('0' + v);
+        }
+        while (p != buf + 20) *out++ = *p++;
+        return out;
+    }
+
+} // namespace detail
+
+// ============================================================================
+// Parsing
+// ============================================================================
+
+/**
+ * @brief Parse a decimal epoch timestamp in a known unit
+ * @param s "[-]digits[.digits]"
+ * @param unit Unit of the integer part
+ * @return Unix nanoseconds, or std::nullopt if malformed or out of int64 range
+ * @note Fraction digits below one nanosecond are truncated (toward zero).
+ * Every value written by write_epoch() at full precision parses back,
+ * INT64_MIN included.
+ */
+[[nodiscard]] constexpr std::optional<int64_t> parse_epoch_nanos(std::string_view s, EpochUnit unit) noexcept {
+    const char* p = s.data();
+    const char* end = p + s.size();
+    bool negative = p != end && *p == '-';
+    p += negative;
+
+    uint64_t whole = 0;
+    size_t digits = detail::read_digit_run(p, end, whole, 19);
+    if (digits == 0 || digits > 19) return std::nullopt;
+
+    uint64_t frac = 0;
+    size_t frac_digits = 0;
+    if (p != end && *p == '.') {
+        ++p;
+        frac_digits = detail::read_digit_run(p, end, frac, 9);
+        if (frac_digits == 0) return std::nullopt;
+    }
+    if (p != end) return std::nullopt;
+
+    // Magnitude in uint64 so that INT64_MIN (one past INT64_MAX) is reachable
+    uint64_t scale = static_cast<uint64_t>(detail::EPOCH_UNIT_SCALE[static_cast<size_t>(unit)]);
+    uint64_t limit = static_cast<uint64_t>(INT64_MAX) + negative;
+    size_t kept = frac_digits < 9 ? frac_digits : 9;
+    uint64_t sub = frac * scale / detail::POW10[kept];
+    if (whole > limit / scale || whole * scale > limit - sub) return std::nullopt;
+    uint64_t mag = whole * scale + sub;
+    return static_cast<int64_t>(negative ? uint64_t{0} - mag : mag);
+}
+
+/**
+ * @brief Parse a decimal epoch timestamp, detecting its unit
+ * @param s "1700000000", "1700000000123", "1700000000.123456", ...
+ * @return Unix nanoseconds, or std::nullopt if malformed or out of range
+ *
+ * @details The unit follows from the number of integer digits, which is
+ * unambiguous for dates between 2001-09-09 and 2286-11-20:
+ * up to 10 digits are seconds, 11-13 milliseconds, 14-16 microseconds and
+ * 17-19 nanoseconds. A fraction is a fraction of that unit.
+ */
+[[nodiscard]] constexpr std::optional<int64_t> parse_epoch_nanos(std::string_view s) noexcept {
+    size_t sign = !s.empty() && s[0] == '-';
+    size_t digits = s.find('.');
+    digits = (digits == std::string_view::npos ? s.size() : digits) - sign;
+    return parse_epoch_nanos(s, detail::unit_for_digits(digits));
+}
+
+/**
+ * @brief Parse a decimal epoch timestamp into a DateTime, detecting its unit
+ * @return DateTime, or std::nullopt if malformed or out of range
+ */
+[[nodiscard]] constexpr std::optional<DateTime> parse_epoch(std::string_view s) noexcept {
+    if (auto ns = parse_epoch_nanos(s)) return DateTime::from_unix_nanos(*ns);
+    return std::nullopt;
+}
+
+/**
+ * @brief Parse many epoch timestamps (unit detected per entry)
+ * @param in Input strings
+ * @param out Unix nanoseconds (same length as in); failures hold EPOCH_PARSE_ERROR
+ * @return Number of entries parsed successfully
+ * @note Large batches are split across hardware threads
+ */
+inline size_t parse_epoch_nanos(std::span<const std::string_view> in, std::span<int64_t> out) {
+    size_t n = std::min(in.size(), out.size());
+    size_t workers = detail::worker_count(n, 1u << 16);
+    std::vector<size_t> parsed(workers, 0);
+    detail::parallel_chunks(n, workers, [&](size_t b, size_t e, size_t w) {
+        size_t ok = 0;
+        for (size_t i = b; i < e; ++i) {
+            auto ns = parse_epoch_nanos(in[i]);
+            out[i] = ns ? *ns : EPOCH_PARSE_ERROR;
+            ok += ns.has_value();
+        }
+        parsed[w] = ok;
+    });
+    size_t total = 0;
+    for (size_t c : parsed) total += c;
+    return total;
+}
+
+/**
+ * @brief Parse many epoch timestamps into DateTime values
+ * @param in Input strings
+ * @param out Datetimes (same length as in); failures hold DateTime()
+ * @return Number of entries parsed successfully
+ */
+inline size_t parse_epoch(std::span<const std::string_view> in, std::span<DateTime> out) {
+    size_t n = std::min(in.size(), out.size());
+    size_t workers = detail::worker_count(n, 1u << 16);
+    std::vector<size_t> parsed(workers, 0);
+    detail::parallel_chunks(n, workers, [&](size_t b, size_t e, size_t w) {
+        size_t ok = 0;
+        for (size_t i = b; i < e; ++i) {
+            auto ns = parse_epoch_nanos(in[i]);
+            out[i] = ns ? DateTime::from_unix_nanos(*ns) : DateTime();
+            ok += ns.has_value();
+        }
+        parsed[w] = ok;
+    });
+    size_t total = 0;
+    for (size_t c : parsed) total += c;
+    return total;
+}
+
+// ============================================================================
+// Formatting
+// ============================================================================
+
+/**
+ * @brief Write epoch nanoseconds as a fixed-point decimal in the given unit
+ * @param nanos Unix nanoseconds
+ * @param unit Unit of the integer part
+ * @param decimals Fraction digits (clamped to the digits the unit has below
+ *        one nanosecond: 9 for seconds, 6 for ms, 3 for us, 0 for ns)
+ * @param out Buffer of at least EPOCH_MAX_LENGTH bytes
+ * @return Number of characters written
+ *
+ * @details Fractions are truncated, not rounded, so the output never moves
+ * into the next unit. Negative values are written as sign and magnitude
+ * ("-1.500" for -1.5 s).
+ */
+constexpr size_t write_epoch(int64_t nanos, EpochUnit unit, int decimals, char* out) noexcept {
+    char* p = out;
+    uint64_t mag = nanos < 0 ? uint64_t{0} - static_cast<uint64_t>(nanos) : static_cast<uint64_t>(nanos);
+    if (nanos < 0) *p++ = '-';
+
+    uint64_t scale = static_cast<uint64_t>(detail::EPOCH_UNIT_SCALE[static_cast<size_t>(unit)]);
+    int max_decimals = 9 - 3 * static_cast<int>(unit);
+    decimals = decimals < 0 ? 0 : (decimals > max_decimals ? max_decimals : decimals);
+
+    p = detail::write_u64(p, mag / scale);
+    if (decimals > 0) {
+        uint64_t frac = (mag % scale) / detail::POW10[max_decimals - decimals];
+        *p++ = '.';
+        for (int i = decimals - 1; i >= 0; --i) {
+            p[i] = static_cast<char>('0' + frac % 10);
+            frac /= 10;
+        }
+        p += decimals;
+    }
+    return static_cast<size_t>(p - out);
+}
+
+/**
+ * @brief Format epoch nanoseconds as a fixed-point decimal string
+ * @return String such as "1700000000.123456"
+ */
+[[nodiscard]] inline std::string to_epoch_string(int64_t nanos, EpochUnit unit = EpochUnit::Seconds,
+                                                 int decimals = 0) {
+    char buf[EPOCH_MAX_LENGTH];
+    return std::string(buf, write_epoch(nanos, unit, decimals, buf));
+}
+
+/**
+ * @brief Write many timestamps, each followed by a separator
+ * @param in Unix nanoseconds
+ * @param unit Unit of the integer part
+ * @param decimals Fraction digits (see write_epoch())
+ * @param out Buffer of at least in.size() * (EPOCH_MAX_LENGTH + 1) bytes
+ * @param separator Character written after every value
+ * @return Number of characters written
+ */
+inline size_t format_epoch(std::span<const int64_t> in, EpochUnit unit, int decimals, char* out,
+                           char separator = '\n') noexcept {
+    char* p = out;
+    for (int64_t ns : in) {
+        p += write_epoch(ns, unit, decimals, p);
+        *p++ = separator;
+    }
+    return static_cast<size_t>(p - out);
+}
+
+} // namespace zuu
@@ -300,6 +300,39 @@ void example_realworld() {
     std::cout << "Work duration: " << hours << " hours " << minutes << " minutes" << std::endl;
 }
 
+// ============================================================================
+// Example 11: std::chrono Interop
+// ============================================================================
+void example_chrono_interop() {
+    std::cout << "\n=== std::chrono Interop ===" << std::endl;
+    
+    namespace ch = std::chrono;
+    
+    // Compile-time differential checks against std::chrono
+    constexpr zuu::Date leap_day(2024, 2, 29);
+    static_assert(leap_day.to_sys_days() == ch::sys_days(ch::year(2024) / 2 / 29));
+    static_assert(leap_day.to_year_month_day() == ch::year(2024) / 2 / 29);
+    static_assert(zuu::Date::from_sys_days(ch::sys_days(ch::days(-719162))) == zuu::Date(1, 1, 1));
+    static_assert(leap_day.day_of_week() ==
+                  static_cast<int>(ch::weekday(leap_day.to_sys_days()).iso_encoding()) - 1);
+    
+    constexpr zuu::DateTime precise(2024, 7, 4, 14, 30, 45, 123456789);
+    constexpr auto tp = precise.to_sys_time();
+    static_assert(tp == ch::sys_days(ch::year(2024) / 7 / 4) + ch::hours(14) + ch::minutes(30) +
+                        ch::seconds(45) + ch::nanoseconds(123456789));
+    static_assert(zuu::DateTime::from_sys_time(tp) == precise);
+    
+    // Runtime round trip through the system clock
+    auto now = ch::system_clock::now();
+    zuu::DateTime dt = zuu::DateTime::from_sys_time(now);
+    assert(dt.to_sys_time() == ch::floor<ch::nanoseconds>(now));
+    
+    ch::hh_mm_ss hms = precise.get_time().to_hh_mm_ss();
+    std::cout << "sys_time round trip: " << dt.to_iso8601_ns() << std::endl;
+    std::cout << "hh_mm_ss: " << hms.hours().count() << "h " << hms.minutes().count() << "m "
+              << hms.seconds().count() << "s " << hms.subseconds().count() << "ns" << std::endl;
+}
+
 // ============================================================================
 // Main
 // ============================================================================
@@ -318,6 +351,7 @@ int main() {
         example_constexpr();
         example_comparisons();
         example_realworld();
+        example_chrono_interop();
         
         std::cout << "\n=============================================" << std::endl;
         std::cout << "All examples completed successfully!" << std::endl;
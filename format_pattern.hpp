@@ -0,0 +1,252 @@
+/**
+ * @file format_pattern.hpp
+ * @brief Compiled form of the %-specifier format language
+ * @author zuudevs (zuudevs@gmail.com)
+ * @version 1.1.1
+ * @date 2026-10-16
+ */
+
+#pragma once
+
+#include "datetime_config.hpp"
+#include <string_view>
+#include <vector>
+
+namespace zuu {
+
+/**
+ * @class FormatPattern
+ * @brief Format string compiled into a flat list of steps
+ *
+ * @details
+ * Understands exactly the specifiers of Date::format(), Time::format() and
+ * DateTime::format(): %Y %m %d %w %j %q %W %B %b %A %a %H %M %S %f %u %N
+ * and %%. Like format(), an unknown specifier stands for the character
+ * after the '%', and a trailing '%' is a literal. Adjacent literal text is
+ * merged into one step.
+ *
+ * Compile a pattern once and reuse it to skip pattern interpretation on
+ * every call (see DateTime::parse()).
+ */
+class FormatPattern {
+public:
+    /**
+     * @brief Step opcodes
+     */
+    enum class Op : uint8_t {
+        Literal,         ///< Verbatim text
+        Year,            ///< %Y  4 digits
+        Month,           ///< %m  2 digits
+        Day,             ///< %d  2 digits
+        Weekday,         ///< %w  1 digit, 0=Monday
+        DayOfYear,       ///< %j  3 digits
+        Quarter,         ///< %q  1 digit
+        Week,            ///< %W  2 digits (ISO 8601)
+        MonthName,       ///< %B
+        MonthAbbrev,     ///< %b
+        WeekdayName,     ///< %A
+        WeekdayAbbrev,   ///< %a
+        Hour,            ///< %H  2 digits
+        Minute,          ///< %M  2 digits
+        Second,          ///< %S  2 digits
+        Milli,           ///< %f  3 digits
+        Micro,           ///< %u  6 digits
+        Nano             ///< %N  9 digits
+    };
+
+    /**
+     * @brief One instruction of the compiled program
+     */
+    struct Step {
+        Op op;              ///< Opcode
+        uint32_t offset;    ///< Literal: offset into literals()
+        uint32_t length;    ///< Literal: byte count
+    };
+
+    /**
+     * @brief Broken-down fields recovered by parse()
+     */
+    struct Fields {
+        int year = 1, month = 1, day = 1;
+        int hour = 0, minute = 0, second = 0, nanosecond = 0;
+        int day_of_year = 0;    ///< 0 if not parsed
+        int weekday = -1;       ///< -1 if not parsed (0=Monday)
+        int quarter = 0;        ///< 0 if not parsed
+        int week = 0;           ///< 0 if not parsed
+        bool has_month = false, has_day = false;
+    };
+
+private:
+    std::vector<Step> steps_;
+    std::string literals_;
+
+    static constexpr Op op_for(char spec) noexcept {
+        switch (spec) {
+            case 'Y': return Op::Year;
+            case 'm': return Op::Month;
+            case 'd': return Op::Day;
+            case 'w': return Op::Weekday;
+            case 'j': return Op::DayOfYear;
+            case 'q': return Op::Quarter;
+            case 'W': return Op::Week;
+            case 'B': return Op::MonthName;
+            case 'b': return Op::MonthAbbrev;
+            case 'A': return Op::WeekdayName;
+            case 'a': return Op::WeekdayAbbrev;
+            case 'H': return Op::Hour;
+            case 'M': return Op::Minute;
+            case 'S': return Op::Second;
+            case 'f': return Op::Milli;
+            case 'u': return Op::Micro;
+            case 'N': return Op::Nano;
+            default: return Op::Literal;
+        }
+    }
+
+    void append_literal(char c) {
+        if (steps_.empty() || steps_.back().op != Op::Literal) {
+            steps_.push_back({Op::Literal, static_cast<uint32_t>(literals_.size()), 0});
+        }
+        literals_ += c;
+        ++steps_.back().length;
+    }
+
+    /// Read exactly `width` digits at pos
+    static constexpr bool read_digits(std::string_view in, size_t& pos, int width, int& out) noexcept {
+        if (in.size() - pos < static_cast<size_t>(width)) return false;
+        int v = 0;
+        for (int i = 0; i < width; ++i) {
+            unsigned d = static_cast<unsigned>(in[pos + i]) - '0';
+            if (d > 9) return false;
+            v = v * 10 + static_cast<int>(d);
+        }
+        pos += static_cast<size_t>(width);
+        out = v;
+        return true;
+    }
+
+    /// Match one of the names in a table, returning its index
+    template <size_t N>
+    static constexpr bool read_name(std::string_view in, size_t& pos,
+                                    const std::array<const char*, N>& names, int& out) noexcept {
+        std::string_view rest = in.substr(pos);
+        for (size_t i = 0; i < N; ++i) {
+            std::string_view name = names[i];
+            if (rest.substr(0, name.size()) == name) {
+                pos += name.size();
+                out = static_cast<int>(i);
+                return true;
+            }
+        }
+        return false;
+    }
+
+public:
+    /**
+     * @brief Default constructor - empty pattern
+     */
+    FormatPattern() = default;
+
+    /**
+     * @brief Compile a format string
+     * @param fmt Format string using the %-specifier language
+     */
+    explicit FormatPattern(std::string_view fmt) {
+        for (size_t i = 0; i < fmt.size(); ++i) {
+            if (fmt[i] == '%' && i + 1 < fmt.size()) {
+                char spec = fmt[++i];
+                Op op = op_for(spec);
+                if (op == Op::Literal) {
+                    append_literal(spec);   // "%%" and unknown specifiers
+                } else {
+                    steps_.push_back({op, 0, 0});
+                }
+            } else {
+                append_literal(fmt[i]);
+            }
+        }
+    }
+
+    /**
+     * @brief Get compiled steps
+     */
+    [[nodiscard]] const std::vector<Step>& steps() const noexcept { return steps_; }
+
+    /**
+     * @brief Get text referenced by literal steps
+     */
+    [[nodiscard]] std::string_view literal(const Step& s) const noexcept {
+        return std::string_view(literals_).substr(s.offset, s.length);
+    }
+
+    /**
+     * @brief Check if the pattern contains a given opcode
+     */
+    [[nodiscard]] bool has(Op op) const noexcept {
+        for (const auto& s : steps_) {
+            if (s.op == op) return true;
+        }
+        return false;
+    }
+
+    /**
+     * @brief Run the program over input text
+     * @param in Text to parse; must be consumed entirely
+     * @param out Fields found (unparsed fields keep their defaults)
+     * @return false if the text does not match the pattern
+     *
+     * @details Numeric fields have the fixed widths that format() produces.
+     * Names (%B %b %A %a) are matched case-sensitively in English. Field
+     * values are not range-checked here; see DateTime::try_parse().
+     */
+    [[nodiscard]] bool parse(std::string_view in, Fields& out) const noexcept {
+        size_t pos = 0;
+        int frac = 0;
+        for (const auto& s : steps_) {
+            bool ok = true;
+            switch (s.op) {
+                case Op::Literal: {
+                    std::string_view lit = literal(s);
+                    ok = in.substr(pos, lit.size()) == lit;
+                    pos += lit.size();
+                    break;
+                }
+                case Op::Year: ok = read_digits(in, pos, 4, out.year); break;
+                case Op::Month: ok = read_digits(in, pos, 2, out.month); out.has_month = true; break;
+                case Op::Day: ok = read_digits(in, pos, 2, out.day); out.has_day = true; break;
+                case Op::Weekday: ok = read_digits(in, pos, 1, out.weekday); break;
+                case Op::DayOfYear: ok = read_digits(in, pos, 3, out.day_of_year); break;
+                case Op::Quarter: ok = read_digits(in, pos, 1, out.quarter); break;
+                case Op::Week: ok = read_digits(in, pos, 2, out.week); break;
+                case Op::MonthName:
+                    ok = read_name(in, pos, detail::MONTH_NAMES, out.month);
+                    ++out.month;
+                    out.has_month = true;
+                    break;
+                case Op::MonthAbbrev:
+                    ok = read_name(in, pos, detail::MONTH_ABBREV, out.month);
+                    ++out.month;
+                    out.has_month = true;
+                    break;
+                case Op::WeekdayName: ok = read_name(in, pos, detail::WEEKDAY_NAMES, out.weekday); break;
+                case Op::WeekdayAbbrev: ok = read_name(in, pos, detail::WEEKDAY_ABBREV, out.weekday); break;
+                case Op::Hour: ok = read_digits(in, pos, 2, out.hour); break;
+                case Op::Minute: ok = read_digits(in, pos, 2, out.minute); break;
+                case Op::Second: ok = read_digits(in, pos, 2, out.second); break;
+                case Op::Milli:
+                    ok = read_digits(in, pos, 3, frac);
+                    out.nanosecond = frac * static_cast<int>(detail::NANOS_PER_MILLISECOND);
+                    break;
+                case Op::Micro:
+                    ok = read_digits(in, pos, 6, frac);
+                    out.nanosecond = frac * static_cast<int>(detail::NANOS_PER_MICROSECOND);
+                    break;
+                case Op::Nano: ok = read_digits(in, pos, 9, out.nanosecond); break;
+            }
+            if (!ok) return false;
+        }
+        return pos == in.size();
+    }
+};
+
+} // namespace zuu
@@ -0,0 +1,149 @@
+/**
+ * @file http_date.hpp
+ * @brief RFC 7231 HTTP-date writer and parser
+ * @author zuudevs (zuudevs@gmail.com)
+ * @version 1.1.1
+ * @date 2026-10-16
+ */
+
+#pragma once
+
+#include "datetime_core.hpp"
+#include <optional>
+#include <string>
+#include <string_view>
+
+namespace zuu {
+
+/**
+ * @brief Length of an IMF-fixdate ("Sun, 06 Nov 1994 08:49:37 GMT")
+ */
+constexpr size_t HTTP_DATE_LENGTH = 29;
+
+namespace detail {
+
+    /// Write two digits
+    constexpr char* put2(char* p, int v) noexcept {
+        p[0] = static_cast<char>('0' + v / 10);
+        p[1] = static_cast<char>('0' + v % 10);
+        return p + 2;
+    }
+
+    /// Copy a 3-letter abbreviation
+    constexpr char* put3(char* p, const char* s) noexcept {
+        p[0] = s[0];
+        p[1] = s[1];
+        p[2] = s[2];
+        return p + 3;
+    }
+
+    constexpr std::optional<DateTime> make_http_datetime(int y, int mon, int d, int h, int m, int s) noexcept {
+        if (mon == 0 || !is_valid_date(y, mon, d) || !fold_leap_second(h, m, s)) return std::nullopt;
+        return DateTime(unchecked, y, mon, d, h, m, s);
+    }
+
+} // namespace detail
+
+// ============================================================================
+// Formatting
+// ============================================================================
+
+/**
+ * @brief Write an IMF-fixdate without allocating
+ * @param dt Datetime in UTC (sub-second part is dropped)
+ * @param out Buffer of at least HTTP_DATE_LENGTH bytes (not NUL-terminated)
+ * @return Number of characters written (always HTTP_DATE_LENGTH)
+ */
+constexpr size_t write_http_date(const DateTime& dt, char* out) noexcept {
+    char* p = detail::put3(out, detail::WEEKDAY_ABBREV[dt.day_of_week()]);
+    *p++ = ',';
+    *p++ = ' ';
+    p = detail::put2(p, dt.day());
+    *p++ = ' ';
+    p = detail::put3(p, detail::MONTH_ABBREV[dt.month() - 1]);
+    *p++ = ' ';
+    p = detail::put2(p, dt.year() / 100);
+    p = detail::put2(p, dt.year() % 100);
+    *p++ = ' ';
+    p = detail::put2(p, dt.hour());
+    *p++ = ':';
+    p = detail::put2(p, dt.minute());
+    *p++ = ':';
+    p = detail::put2(p, dt.second());
+    p = detail::put3(p, " GM");
+    *p = 'T';
+    return HTTP_DATE_LENGTH;
+}
+
+/**
+ * @brief Format as IMF-fixdate
+ * @return String such as "Sun, 06 Nov 1994 08:49:37 GMT"
+ */
+[[nodiscard]] inline std::string to_http_date(const DateTime& dt) {
+    char buf[HTTP_DATE_LENGTH];
+    return std::string(buf, write_http_date(dt, buf));
+}
+
+// ============================================================================
+// Parsing
+// ============================================================================
+
+/**
+ * @brief Parse any of the three HTTP-date forms of RFC 7231 section 7.1.1.1
+ * @param s Header value, without surrounding whitespace
+ * @return Datetime in UTC, or std::nullopt if s is malformed
+ *
+ * @details Accepted forms:
+ * - IMF-fixdate: "Sun, 06 Nov 1994 08:49:37 GMT"
+ * - RFC 850:     "Sunday, 06-Nov-94 08:49:37 GMT"
+ * - asctime:     "Sun Nov  6 08:49:37 1994"
+ *
+ * Names are matched case-sensitively through perfect-hash tables. The day
+ * name must be valid but is not checked against the date. RFC 850 two-digit
+ * years use the POSIX pivot: 69-99 map to 19xx, 00-68 to 20xx. Second 60
+ * is accepted only at 23:59:60, the one place a leap second can fall in
+ * GMT, and is read as 23:59:59; at any other minute the date is rejected.
+ */
+[[nodiscard]] constexpr std::optional<DateTime> parse_http_date(std::string_view s) noexcept {
+    int h = 0, m = 0, sec = 0;
+
+    // IMF-fixdate
+    if (s.size() == HTTP_DATE_LENGTH && s[3] == ',') {
+        const char* p = s.data();
+        if (detail::weekday_from_abbrev(p) < 0 || p[4] != ' ' || p[7] != ' ' || p[11] != ' ' ||
+            p[16] != ' ' || s.substr(25) != " GMT" || !detail::read_hms(p + 17, h, m, sec)) {
+            return std::nullopt;
+        }
+        return detail::make_http_datetime(detail::read_4digits(p + 12), detail::month_from_abbrev(p + 8),
+                                          detail::read_2digits(p + 5), h, m, sec);
+    }
+
+    // asctime
+    if (s.size() == 24 && s[3] == ' ') {
+        const char* p = s.data();
+        if (detail::weekday_from_abbrev(p) < 0 || p[7] != ' ' || p[10] != ' ' || p[19] != ' ' ||
+            !detail::read_hms(p + 11, h, m, sec)) {
+            return std::nullopt;
+        }
+        char day[2] = {p[8] == ' ' ? '0' : p[8], p[9]};
+        return detail::make_http_datetime(detail::read_4digits(p + 20), detail::month_from_abbrev(p + 4),
+                                          detail::read_2digits(day), h, m, sec);
+    }
+
+    // RFC 850: full day name, then ", DD-Mon-YY HH:MM:SS GMT" (24 characters)
+    size_t comma = s.find(',');
+    if (comma < 6 || comma > 9 || s.size() != comma + 24) return std::nullopt;
+    int wd = detail::weekday_from_abbrev(s.data());
+    if (wd < 0 || s.substr(0, comma) != detail::WEEKDAY_NAMES[wd]) return std::nullopt;
+    const char* p = s.data() + comma;
+    if (p[1] != ' ' || p[4] != '-' || p[8] != '-' || p[11] != ' ' ||
+        std::string_view(p + 20, 4) != " GMT" || !detail::read_hms(p + 12, h, m, sec)) {
+        return std::nullopt;
+    }
+    int yy = detail::read_2digits(p + 9);
+    if (yy < 0) return std::nullopt;
+    return detail::make_http_datetime(yy + (yy < 69 ? 2000 : 1900), detail::month_from_abbrev(p + 5),
+                                      detail::read_2digits(p + 2), h, m, sec);
+}
+
+} // namespace zuu
@@ -0,0 +1,471 @@
+/**
+ * @file interval_core.hpp
+ * @brief Half-open time intervals and normalised interval sets
+ * @author zuudevs (zuudevs@gmail.com)
+ * @version 1.1.1
+ * @date 2026-10-16
+ */
+
+#pragma once
+
+#include "datetime_core.hpp"
+#include "datetime_parallel.hpp"
+#include <algorithm>
+#include <span>
+#include <utility>
+#include <vector>
+
+namespace zuu {
+
+/**
+ * @brief Maps an interval endpoint type to an order-preserving int64 key
+ *
+ * Specialisations provide to_key() and from_key(). The key unit is the
+ * natural resolution of the type (nanoseconds for DateTime, days for Date).
+ */
+template <typename T>
+struct interval_traits;
+
+/**
+ * @brief DateTime endpoints keyed by Unix nanoseconds
+ * @note Keys are exact for 1677-09-21 to 2262-04-11 (see DateTime::to_unix_nanos)
+ */
+template <>
+struct interval_traits<DateTime> {
+    static constexpr int64_t to_key(const DateTime& v) noexcept { return v.to_unix_nanos(); }
+    static constexpr DateTime from_key(int64_t k) noexcept { return DateTime::from_unix_nanos(k); }
+};
+
+/**
+ * @brief Date endpoints keyed by Unix days
+ */
+template <>
+struct interval_traits<Date> {
+    static constexpr int64_t to_key(const Date& v) noexcept { return v.to_unix_days(); }
+    static constexpr Date from_key(int64_t k) noexcept {
+        return Date::from_unix_days(static_cast<int32_t>(k));
+    }
+};
+
+/**
+ * @brief Raw int64 endpoints (identity mapping)
+ */
+template <>
+struct interval_traits<int64_t> {
+    static constexpr int64_t to_key(int64_t v) noexcept { return v; }
+    static constexpr int64_t from_key(int64_t k) noexcept { return k; }
+};
+
+/**
+ * @class Interval
+ * @brief Half-open range [start, end) of points
+ *
+ * @details
+ * An interval with start == end is empty. Constructing an interval whose end
+ * precedes its start is an error.
+ */
+template <typename T>
+class Interval {
+private:
+    T start_{};   ///< Inclusive lower bound
+    T end_{};     ///< Exclusive upper bound
+
+public:
+    /**
+     * @brief Default constructor - creates an empty interval at T()
+     */
+    constexpr Interval() noexcept = default;
+
+    /**
+     * @brief Construct from bounds
+     * @param start Inclusive lower bound
+     * @param end Exclusive upper bound
+     * @throw std::out_of_range if end < start
+     */
+    constexpr Interval(const T& start, const T& end) : start_(start), end_(end) {
+        if (end < start) {
+            throw std::out_of_range("Interval end precedes start");
+        }
+    }
+
+    /**
+     * @brief Get inclusive lower bound
+     */
+    [[nodiscard]] constexpr const T& start() const noexcept { return start_; }
+
+    /**
+     * @brief Get exclusive upper bound
+     */
+    [[nodiscard]] constexpr const T& end() const noexcept { return end_; }
+
+    /**
+     * @brief Check if interval contains no points
+     */
+    [[nodiscard]] constexpr bool empty() const noexcept { return !(start_ < end_); }
+
+    /**
+     * @brief Check if a point lies in [start, end)
+     */
+    [[nodiscard]] constexpr bool contains(const T& point) const noexcept {
+        return !(point < start_) && point < end_;
+    }
+
+    /**
+     * @brief Check if another interval lies entirely inside this one
+     * @note An empty interval is contained in every interval
+     */
+    [[nodiscard]] constexpr bool contains(const Interval& other) const noexcept {
+        return other.empty() || (!(other.start_ < start_) && !(end_ < other.end_));
+    }
+
+    /**
+     * @brief Check if two intervals share at least one point
+     */
+    [[nodiscard]] constexpr bool overlaps(const Interval& other) const noexcept {
+        return start_ < other.end_ && other.start_ < end_ && !empty() && !other.empty();
+    }
+
+    /**
+     * @brief Equality comparison
+     */
+    [[nodiscard]] constexpr bool operator==(const Interval& other) const noexcept {
+        return start_ == other.start_ && end_ == other.end_;
+    }
+};
+
+/**
+ * @class IntervalSet
+ * @brief Normalised set of disjoint half-open intervals
+ *
+ * @details
+ * Intervals are kept sorted, non-empty, non-overlapping and non-adjacent
+ * ([a,b) and [b,c) are coalesced into [a,c)). Bounds are stored as int64 keys
+ * (see interval_traits) in two flat vectors, so set algebra runs as a linear
+ * merge and point/interval queries are a binary search over the end keys.
+ *
+ * @tparam T Endpoint type (DateTime, Date or int64_t)
+ */
+template <typename T = DateTime>
+class IntervalSet {
+private:
+    using traits = interval_traits<T>;
+
+    std::vector<int64_t> starts_;   ///< Sorted inclusive lower bounds
+    std::vector<int64_t> ends_;     ///< Sorted exclusive upper bounds
+
+    /// Append [s, e), merging with the last interval if they touch
+    void push_merge(int64_t s, int64_t e) {
+        if (!ends_.empty() && s <= ends_.back()) {
+            if (e > ends_.back()) ends_.back() = e;
+        } else {
+            starts_.push_back(s);
+            ends_.push_back(e);
+        }
+    }
+
+    /// Index of the first interval whose end is greater than key
+    [[nodiscard]] size_t first_ending_after(int64_t key) const noexcept {
+        return static_cast<size_t>(std::upper_bound(ends_.begin(), ends_.end(), key) - ends_.begin());
+    }
+
+    /// Sort (start, end) pairs and coalesce them into a normalised set
+    static IntervalSet coalesce_pairs(std::pair<int64_t, int64_t>* first,
+                                      std::pair<int64_t, int64_t>* last) {
+        std::sort(first, last, [](const auto& a, const auto& b) { return a.first < b.first; });
+        IntervalSet out;
+        out.reserve(static_cast<size_t>(last - first));
+        for (auto* p = first; p != last; ++p) {
+            if (p->first < p->second) out.push_merge(p->first, p->second);
+        }
+        return out;
+    }
+
+public:
+    /**
+     * @brief Default constructor - creates an empty set
+     */
+    IntervalSet() = default;
+
+    // ========================================================================
+    // Bulk Construction
+    // ========================================================================
+
+    /**
+     * @brief Build a normalised set from unsorted, possibly overlapping keys
+     * @param starts Inclusive lower bounds (key units)
+     * @param ends Exclusive upper bounds (key units), same length as starts
+     * @return Normalised interval set
+     *
+     * @details
+     * Large inputs are split across hardware threads: every chunk is sorted
+     * and coalesced independently, then chunks are combined by pairwise
+     * linear-merge unions. Empty intervals are dropped.
+     */
+    [[nodiscard]] static IntervalSet build(std::span<const int64_t> starts,
+                                           std::span<const int64_t> ends) {
+        size_t n = std::min(starts.size(), ends.size());
+        std::vector<std::pair<int64_t, int64_t>> pairs(n);
+        for (size_t i = 0; i < n; ++i) pairs[i] = {starts[i], ends[i]};
+
+        size_t workers = detail::worker_count(n, 1u << 16);
+        std::vector<IntervalSet> parts(workers);
+        detail::parallel_chunks(n, workers, [&](size_t b, size_t e, size_t w) {
+            parts[w] = coalesce_pairs(pairs.data() + b, pairs.data() + e);
+        });
+
+        while (parts.size() > 1) {
+            size_t half = (parts.size() + 1) / 2;
+            std::vector<IntervalSet> next(half);
+            detail::parallel_chunks(parts.size() / 2, detail::worker_count(parts.size() / 2, 1),
+                [&](size_t b, size_t e, size_t) {
+                    for (size_t i = b; i < e; ++i) next[i] = parts[2 * i].unite(parts[2 * i + 1]);
+                });
+            if (parts.size() % 2) next.back() = std::move(parts.back());
+            parts = std::move(next);
+        }
+        return parts.empty() ? IntervalSet() : std::move(parts.front());
+    }
+
+    /**
+     * @brief Build a normalised set from unsorted, possibly overlapping intervals
+     * @param items Intervals to insert
+     * @return Normalised interval set
+     */
+    [[nodiscard]] static IntervalSet build(std::span<const Interval<T>> items) {
+        std::vector<int64_t> s(items.size()), e(items.size());
+        for (size_t i = 0; i < items.size(); ++i) {
+            s[i] = traits::to_key(items[i].start());
+            e[i] = traits::to_key(items[i].end());
+        }
+        return build(s, e);
+    }
+
+    // ========================================================================
+    // Accessors
+    // ========================================================================
+
+    /**
+     * @brief Get number of disjoint intervals
+     */
+    [[nodiscard]] size_t size() const noexcept { return starts_.size(); }
+
+    /**
+     * @brief Check if set contains no intervals
+     */
+    [[nodiscard]] bool empty() const noexcept { return starts_.empty(); }
+
+    /**
+     * @brief Get interval by index (sorted order)
+     */
+    [[nodiscard]] Interval<T> operator[](size_t i) const {
+        return Interval<T>(traits::from_key(starts_[i]), traits::from_key(ends_[i]));
+    }
+
+    /**
+     * @brief Get sorted lower bounds as raw keys
+     */
+    [[nodiscard]] std::span<const int64_t> start_keys() const noexcept { return starts_; }
+
+    /**
+     * @brief Get sorted upper bounds as raw keys
+     */
+    [[nodiscard]] std::span<const int64_t> end_keys() const noexcept { return ends_; }
+
+    /**
+     * @brief Total covered length in key units (nanoseconds for DateTime)
+     */
+    [[nodiscard]] int64_t measure() const noexcept {
+        int64_t total = 0;
+        for (size_t i = 0; i < starts_.size(); ++i) total += ends_[i] - starts_[i];
+        return total;
+    }
+
+    // ========================================================================
+    // Modification
+    // ========================================================================
+
+    /**
+     * @brief Reserve storage for n intervals
+     */
+    void reserve(size_t n) {
+        starts_.reserve(n);
+        ends_.reserve(n);
+    }
+
+    /**
+     * @brief Remove all intervals
+     */
+    void clear() noexcept {
+        starts_.clear();
+        ends_.clear();
+    }
+
+    /**
+     * @brief Insert one interval, coalescing with its neighbours
+     * @param iv Interval to add
+     * @return Reference to this set for chaining
+     * @note O(n); use build() for bulk input
+     */
+    IntervalSet& insert(const Interval<T>& iv) {
+        int64_t s = traits::to_key(iv.start());
+        int64_t e = traits::to_key(iv.end());
+        if (!(s < e)) return *this;
+
+        // [lo, hi) is the run of intervals touching [s, e]
+        size_t lo = static_cast<size_t>(std::lower_bound(ends_.begin(), ends_.end(), s) - ends_.begin());
+        size_t hi = static_cast<size_t>(std::upper_bound(starts_.begin(), starts_.end(), e) - starts_.begin());
+        if (lo < hi) {
+            s = std::min(s, starts_[lo]);
+            e = std::max(e, ends_[hi - 1]);
+            starts_.erase(starts_.begin() + lo + 1, starts_.begin() + hi);
+            ends_.erase(ends_.begin() + lo + 1, ends_.begin() + hi);
+            starts_[lo] = s;
+            ends_[lo] = e;
+        } else {
+            starts_.insert(starts_.begin() + lo, s);
+            ends_.insert(ends_.begin() + lo, e);
+        }
+        return *this;
+    }
+
+    // ========================================================================
+    // Queries
+    // ========================================================================
+
+    /**
+     * @brief Check if a point is covered by the set
+     * @note O(log n)
+     */
+    [[nodiscard]] bool contains(const T& point) const noexcept {
+        int64_t k = traits::to_key(point);
+        size_t i = first_ending_after(k);
+        return i < starts_.size() && starts_[i] <= k;
+    }
+
+    /**
+     * @brief Check if an interval is entirely covered by the set
+     * @note O(log n); an empty interval is always contained
+     */
+    [[nodiscard]] bool contains(const Interval<T>& iv) const noexcept {
+        int64_t s = traits::to_key(iv.start());
+        int64_t e = traits::to_key(iv.end());
+        if (!(s < e)) return true;
+        size_t i = first_ending_after(s);
+        return i < starts_.size() && starts_[i] <= s && e <= ends_[i];
+    }
+
+    /**
+     * @brief Check if an interval shares any point with the set
+     * @note O(log n)
+     */
+    [[nodiscard]] bool overlaps(const Interval<T>& iv) const noexcept {
+        int64_t s = traits::to_key(iv.start());
+        int64_t e = traits::to_key(iv.end());
+        if (!(s < e)) return false;
+        size_t i = first_ending_after(s);
+        return i < starts_.size() && starts_[i] < e;
+    }
+
+    // ========================================================================
+    // Set Algebra (linear merges)
+    // ========================================================================
+
+    /**
+     * @brief Union of two sets
+     * @return Points covered by either set
+     */
+    [[nodiscard]] IntervalSet unite(const IntervalSet& other) const {
+        IntervalSet out;
+        out.reserve(size() + other.size());
+        size_t i = 0, j = 0;
+        while (i < size() || j < other.size()) {
+            if (j == other.size() || (i < size() && starts_[i] <= other.starts_[j])) {
+                out.push_merge(starts_[i], ends_[i]);
+                ++i;
+            } else {
+                out.push_merge(other.starts_[j], other.ends_[j]);
+                ++j;
+            }
+        }
+        return out;
+    }
+
+    /**
+     * @brief Intersection of two sets
+     * @return Points covered by both sets
+     */
+    [[nodiscard]] IntervalSet intersect(const IntervalSet& other) const {
+        IntervalSet out;
+        out.reserve(std::max(size(), other.size()));
+        size_t i = 0, j = 0;
+        while (i < size() && j < other.size()) {
+            int64_t lo = std::max(starts_[i], other.starts_[j]);
+            int64_t hi = std::min(ends_[i], other.ends_[j]);
+            if (lo < hi) {
+                out.starts_.push_back(lo);
+                out.ends_.push_back(hi);
+            }
+            if (ends_[i] < other.ends_[j]) ++i; else ++j;
+        }
+        return out;
+    }
+
+    /**
+     * @brief Difference of two sets
+     * @return Points covered by this set but not by other
+     */
+    [[nodiscard]] IntervalSet subtract(const IntervalSet& other) const {
+        IntervalSet out;
+        out.reserve(size() + other.size());
+        size_t j = 0;
+        for (size_t i = 0; i < size(); ++i) {
+            int64_t cur = starts_[i];
+            int64_t e = ends_[i];
+            while (j < other.size() && other.ends_[j] <= cur) ++j;
+            size_t k = j;
+            while (k < other.size() && other.starts_[k] < e) {
+                if (other.starts_[k] > cur) {
+                    out.starts_.push_back(cur);
+                    out.ends_.push_back(other.starts_[k]);
+                }
+                cur = std::max(cur, other.ends_[k]);
+                if (cur >= e) break;
+                ++k;
+            }
+            if (cur < e) {
+                out.starts_.push_back(cur);
+                out.ends_.push_back(e);
+            }
+            j = k;
+        }
+        return out;
+    }
+
+    /**
+     * @brief Union operator
+     */
+    [[nodiscard]] IntervalSet operator|(const IntervalSet& other) const { return unite(other); }
+
+    /**
+     * @brief Intersection operator
+     */
+    [[nodiscard]] IntervalSet operator&(const IntervalSet& other) const { return intersect(other); }
+
+    /**
+     * @brief Difference operator
+     */
+    [[nodiscard]] IntervalSet operator-(const IntervalSet& other) const { return subtract(other); }
+
+    IntervalSet& operator|=(const IntervalSet& other) { return *this = unite(other); }
+    IntervalSet& operator&=(const IntervalSet& other) { return *this = intersect(other); }
+    IntervalSet& operator-=(const IntervalSet& other) { return *this = subtract(other); }
+
+    /**
+     * @brief Equality comparison
+     */
+    [[nodiscard]] bool operator==(const IntervalSet& other) const noexcept {
+        return starts_ == other.starts_ && ends_ == other.ends_;
+    }
+};
+
+} // namespace zuu
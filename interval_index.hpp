@@ -0,0 +1,251 @@
+/**
+ * @file interval_index.hpp
+ * @brief Static augmented interval index for stabbing and overlap queries
+ * @author zuudevs (zuudevs@gmail.com)
+ * @version 1.1.1
+ * @date 2026-10-16
+ */
+
+#pragma once
+
+#include "interval_core.hpp"
+#include <limits>
+#include <numeric>
+
+namespace zuu {
+
+/**
+ * @class IntervalIndex
+ * @brief Immutable index over (start, end, payload) triples
+ *
+ * @details
+ * Entries are sorted by start and laid out as an implicit binary tree over
+ * the sorted array: the node at index i sits at level "number of trailing
+ * one bits of i", and every node stores the maximum end key of its subtree.
+ * There are no pointers; keys, subtree maxima and payloads live in separate
+ * flat vectors, so a query touches O(log n) cache lines plus the k results.
+ *
+ * Intervals are half-open [start, end); as with Interval::overlaps, empty
+ * entries match no query. Queries run in O(log n + k).
+ *
+ * @tparam P Payload type
+ * @tparam T Endpoint type (DateTime, Date or int64_t)
+ */
+template <typename P, typename T = DateTime>
+class IntervalIndex {
+public:
+    /**
+     * @brief Bulk-load record
+     */
+    struct Entry {
+        T start;     ///< Inclusive lower bound
+        T end;       ///< Exclusive upper bound
+        P payload;   ///< User data returned by queries
+    };
+
+private:
+    using traits = interval_traits<T>;
+
+    std::vector<int64_t> starts_;    ///< Start keys, sorted
+    std::vector<int64_t> ends_;      ///< End keys, in start order
+    std::vector<int64_t> max_end_;   ///< Max end key of each implicit subtree
+    std::vector<P> payloads_;        ///< Payloads, in start order
+    int max_level_ = -1;             ///< Level of the root node
+
+    /// Compute subtree maxima bottom-up; returns the root level
+    int index_tree() {
+        size_t n = starts_.size();
+        max_end_.assign(ends_.begin(), ends_.end());
+        if (n == 0) return -1;
+
+        size_t last_i = 0;
+        int64_t last = 0;
+        for (size_t i = 0; i < n; i += 2) {
+            last_i = i;
+            last = ends_[i];
+        }
+        int k = 1;
+        for (; (size_t{1} << k) <= n; ++k) {
+            size_t x = size_t{1} << (k - 1);
+            size_t i0 = (x << 1) - 1;
+            size_t step = x << 2;
+            for (size_t i = i0; i < n; i += step) {
+                int64_t el = max_end_[i - x];
+                int64_t er = i + x < n ? max_end_[i + x] : last;
+                max_end_[i] = std::max({ends_[i], el, er});
+            }
+            last_i = ((last_i >> k) & 1) ? last_i - x : last_i + x;
+            if (last_i < n && max_end_[last_i] > last) last = max_end_[last_i];
+        }
+        return k - 1;
+    }
+
+    /// Visit indices of all entries overlapping [s, e)
+    template <typename F>
+    void visit(int64_t s, int64_t e, F&& fn) const {
+        if (max_level_ < 0 || !(s < e)) return;
+        struct Frame { int k; size_t x; bool second; };
+        Frame stack[128];
+        int t = 0;
+        size_t n = starts_.size();
+        stack[t++] = {max_level_, (size_t{1} << max_level_) - 1, false};
+        while (t) {
+            Frame z = stack[--t];
+            if (z.k <= 3) {
+                // Small subtree: scan its contiguous span of the sorted array
+                size_t i0 = z.x >> z.k << z.k;
+                size_t i1 = std::min(n, i0 + (size_t{1} << (z.k + 1)) - 1);
+                for (size_t i = i0; i < i1 && starts_[i] < e; ++i) {
+                    if (s < ends_[i] && starts_[i] < ends_[i]) fn(i);
+                }
+            } else if (!z.second) {
+                size_t y = z.x - (size_t{1} << (z.k - 1));
+                stack[t++] = {z.k, z.x, true};
+                if (y >= n || max_end_[y] > s) stack[t++] = {z.k - 1, y, false};
+            } else if (z.x < n && starts_[z.x] < e) {
+                if (s < ends_[z.x] && starts_[z.x] < ends_[z.x]) fn(z.x);
+                stack[t++] = {z.k - 1, z.x + (size_t{1} << (z.k - 1)), false};
+            }
+        }
+    }
+
+public:
+    /**
+     * @brief Default constructor - creates an empty index
+     */
+    IntervalIndex() = default;
+
+    // ========================================================================
+    // Bulk Construction
+    // ========================================================================
+
+    /**
+     * @brief Bulk-load from raw keys and payloads
+     * @param starts Inclusive lower bounds (key units)
+     * @param ends Exclusive upper bounds (key units)
+     * @param payloads Payload per entry
+     * @return Index over the given entries
+     * @note Entries are sorted by start using all hardware threads
+     */
+    [[nodiscard]] static IntervalIndex build(std::span<const int64_t> starts,
+                                             std::span<const int64_t> ends,
+                                             std::span<const P> payloads) {
+        size_t n = std::min({starts.size(), ends.size(), payloads.size()});
+        std::vector<size_t> order(n);
+        std::iota(order.begin(), order.end(), size_t{0});
+        detail::parallel_sort(order.begin(), order.end(),
+            [&](size_t a, size_t b) { return starts[a] < starts[b]; });
+
+        IntervalIndex idx;
+        idx.starts_.resize(n);
+        idx.ends_.resize(n);
+        idx.payloads_.reserve(n);
+        for (size_t i = 0; i < n; ++i) {
+            idx.starts_[i] = starts[order[i]];
+            idx.ends_[i] = ends[order[i]];
+            idx.payloads_.push_back(payloads[order[i]]);
+        }
+        idx.max_level_ = idx.index_tree();
+        return idx;
+    }
+
+    /**
+     * @brief Bulk-load from entries
+     * @param entries (start, end, payload) triples in any order
+     * @return Index over the given entries
+     */
+    [[nodiscard]] static IntervalIndex build(std::span<const Entry> entries) {
+        std::vector<int64_t> s(entries.size()), e(entries.size());
+        std::vector<P> p;
+        p.reserve(entries.size());
+        for (size_t i = 0; i < entries.size(); ++i) {
+            s[i] = traits::to_key(entries[i].start);
+            e[i] = traits::to_key(entries[i].end);
+            p.push_back(entries[i].payload);
+        }
+        return build(s, e, p);
+    }
+
+    // ========================================================================
+    // Accessors
+    // ========================================================================
+
+    /**
+     * @brief Get number of indexed entries
+     */
+    [[nodiscard]] size_t size() const noexcept { return starts_.size(); }
+
+    /**
+     * @brief Check if index contains no entries
+     */
+    [[nodiscard]] bool empty() const noexcept { return starts_.empty(); }
+
+    /**
+     * @brief Get interval of entry i (start order)
+     */
+    [[nodiscard]] Interval<T> interval(size_t i) const {
+        return Interval<T>(traits::from_key(starts_[i]), traits::from_key(ends_[i]));
+    }
+
+    /**
+     * @brief Get payload of entry i (start order)
+     */
+    [[nodiscard]] const P& payload(size_t i) const noexcept { return payloads_[i]; }
+
+    // ========================================================================
+    // Queries
+    // ========================================================================
+
+    /**
+     * @brief Invoke fn(payload) for every entry overlapping a range
+     * @param range Half-open query range
+     * @param fn Callable taking const P&
+     */
+    template <typename F>
+    void for_each_overlap(const Interval<T>& range, F&& fn) const {
+        visit(traits::to_key(range.start()), traits::to_key(range.end()),
+              [&](size_t i) { fn(payloads_[i]); });
+    }
+
+    /**
+     * @brief Invoke fn(payload) for every entry containing a point
+     * @param point Query instant
+     * @param fn Callable taking const P&
+     */
+    template <typename F>
+    void for_each_stab(const T& point, F&& fn) const {
+        int64_t k = traits::to_key(point);
+        // No half-open interval contains the largest key
+        if (k == std::numeric_limits<int64_t>::max()) return;
+        visit(k, k + 1, [&](size_t i) { fn(payloads_[i]); });
+    }
+
+    /**
+     * @brief Collect payloads of entries overlapping a range
+     */
+    [[nodiscard]] std::vector<P> overlapping(const Interval<T>& range) const {
+        std::vector<P> out;
+        for_each_overlap(range, [&](const P& p) { out.push_back(p); });
+        return out;
+    }
+
+    /**
+     * @brief Collect payloads of entries containing a point
+     */
+    [[nodiscard]] std::vector<P> stabbing(const T& point) const {
+        std::vector<P> out;
+        for_each_stab(point, [&](const P& p) { out.push_back(p); });
+        return out;
+    }
+
+    /**
+     * @brief Count entries overlapping a range without materialising them
+     */
+    [[nodiscard]] size_t count_overlaps(const Interval<T>& range) const {
+        size_t count = 0;
+        visit(traits::to_key(range.start()), traits::to_key(range.end()), [&](size_t) { ++count; });
+        return count;
+    }
+};
+
+} // namespace zuu
@@ -0,0 +1,173 @@
+/**
+ * @file iso8601_batch.hpp
+ * @brief Fixed-width ISO 8601 rendering of DateTime columns into one buffer
+ * @author zuudevs (zuudevs@gmail.com)
+ * @version 1.1.1
+ * @date 2026-10-16
+ */
+
+#pragma once
+
+#include "datetime_core.hpp"
+#include "datetime_parallel.hpp"
+#include <bit>
+#include <cstring>
+#include <span>
+#include <stdexcept>
+
+namespace zuu {
+
+/**
+ * @brief Number of fraction digits in a rendered timestamp
+ */
+enum class IsoPrecision : uint8_t {
+    Seconds,        ///< YYYY-MM-DDTHH:MM:SS            (19 bytes)
+    Milliseconds,   ///< YYYY-MM-DDTHH:MM:SS.fff        (23 bytes)
+    Microseconds,   ///< YYYY-MM-DDTHH:MM:SS.uuuuuu     (26 bytes)
+    Nanoseconds     ///< YYYY-MM-DDTHH:MM:SS.nnnnnnnnn  (29 bytes)
+};
+
+/**
+ * @brief Distance in bytes between the starts of consecutive rows
+ */
+struct Stride {
+    size_t bytes;
+};
+
+/**
+ * @brief Length of one rendered timestamp
+ */
+[[nodiscard]] constexpr size_t iso8601_length(IsoPrecision p) noexcept {
+    return p == IsoPrecision::Seconds ? 19 : 20 + 3 * static_cast<size_t>(p);
+}
+
+namespace detail {
+
+    /**
+     * @brief Four values < 100 in 16-bit lanes to eight ASCII digits
+     * @details Lane-parallel x / 10 as (x * 103) >> 10, exact for x < 179;
+     * no product crosses into the next lane.
+     */
+    constexpr uint64_t pairs_to_ascii(uint64_t lanes) noexcept {
+        uint64_t tens = ((lanes * 103) >> 10) & 0x000F000F000F000FULL;
+        uint64_t ones = lanes - tens * 10;
+        return (tens | (ones << 8)) + 0x3030303030303030ULL;
+    }
+
+    /**
+     * @brief Value < 10^8 to eight ASCII digits (first digit in the low byte)
+     * @details Splits into two 32-bit lanes of four digits, then into four
+     * 16-bit lanes of two digits (x / 100 as (x * 10486) >> 20, exact for
+     * x < 10^4), then into bytes.
+     */
+    constexpr uint64_t digits8_to_ascii(uint32_t v) noexcept {
+        uint64_t x = (v / 10000) | (static_cast<uint64_t>(v % 10000) << 32);
+        uint64_t hundreds = ((x * 10486) >> 20) & 0x0000007F0000007FULL;
+        return pairs_to_ascii(hundreds | ((x - hundreds * 100) << 16));
+    }
+
+    /// Store the low `n` bytes of v in memory order, first byte = low byte
+    template <size_t N>
+    inline void store_le(char* out, uint64_t v) noexcept {
+        if constexpr (std::endian::native == std::endian::big) v = __builtin_bswap64(v);
+        std::memcpy(out, &v, N);
+    }
+
+    /// Render one fixed-width row; no separator
+    inline void write_iso8601_row(const DateTime& dt, char* out, IsoPrecision p) noexcept {
+        uint64_t tod = dt.get_time().total_nanoseconds();
+        uint32_t secs = static_cast<uint32_t>(tod / NANOS_PER_SECOND);
+        uint32_t frac = static_cast<uint32_t>(tod - static_cast<uint64_t>(secs) * NANOS_PER_SECOND);
+        uint32_t h = secs / 3600, rem = secs - h * 3600;
+        uint32_t m = rem / 60, s = rem - m * 60;
+        uint32_t y = static_cast<uint32_t>(dt.year());
+
+        uint64_t date = pairs_to_ascii(uint64_t{y / 100} | uint64_t{y % 100} << 16 |
+                                       static_cast<uint64_t>(dt.month()) << 32 |
+                                       static_cast<uint64_t>(dt.day()) << 48);
+        uint64_t time = pairs_to_ascii(uint64_t{h} | uint64_t{m} << 16 | uint64_t{s} << 32);
+
+        // "YYYY-MM-" "DDTHH:MM" ":SS"
+        store_le<8>(out, (date & 0xFFFFFFFFULL) | uint64_t{'-'} << 32 |
+                         ((date >> 32) & 0xFFFF) << 40 | uint64_t{'-'} << 56);
+        store_le<8>(out + 8, (date >> 48) | uint64_t{'T'} << 16 | (time & 0xFFFF) << 24 |
+                             uint64_t{':'} << 40 | ((time >> 16) & 0xFFFF) << 48);
+        store_le<3>(out + 16, uint64_t{':'} | ((time >> 32) & 0xFFFF) << 8);
+        if (p == IsoPrecision::Seconds) return;
+
+        // ".d" then up to eight more digits
+        uint32_t lead = frac / 100'000'000;
+        store_le<2>(out + 19, uint64_t{'.'} | uint64_t{'0' + lead} << 8);
+        uint64_t tail = digits8_to_ascii(frac - lead * 100'000'000);
+        switch (p) {
+            case IsoPrecision::Milliseconds: store_le<2>(out + 21, tail); break;
+            case IsoPrecision::Microseconds: store_le<5>(out + 21, tail); break;
+            default: store_le<8>(out + 21, tail); break;
+        }
+    }
+
+} // namespace detail
+
+/**
+ * @brief Render one timestamp without allocating
+ * @param dt Datetime to render
+ * @param out Buffer of at least iso8601_length(p) bytes (not NUL-terminated)
+ * @param p Fraction digits
+ * @return Number of characters written
+ * @note Same text as DateTime::to_iso8601() / _ms() / _us() / _ns()
+ */
+inline size_t write_iso8601(const DateTime& dt, char* out, IsoPrecision p = IsoPrecision::Milliseconds) noexcept {
+    detail::write_iso8601_row(dt, out, p);
+    return iso8601_length(p);
+}
+
+/**
+ * @brief Render a column of timestamps as separator-terminated rows
+ * @param values Datetimes to render
+ * @param out Buffer of at least values.size() * (iso8601_length(p) + 1) bytes
+ * @param separator Character written after every row (e.g. '\n' or ',')
+ * @param p Fraction digits
+ * @return Number of bytes written
+ *
+ * @details Every row has the same width, so row i starts at a known offset
+ * and large columns are rendered across hardware threads. Digits are
+ * produced with SWAR lane arithmetic: a whole date or time-of-day becomes
+ * ASCII in one 64-bit register without per-digit division.
+ */
+inline size_t format_iso8601(std::span<const DateTime> values, char* out, char separator = '\n',
+                             IsoPrecision p = IsoPrecision::Milliseconds) {
+    size_t len = iso8601_length(p);
+    size_t row = len + 1;
+    size_t workers = detail::worker_count(values.size(), 1u << 16);
+    detail::parallel_chunks(values.size(), workers, [&](size_t b, size_t e, size_t) {
+        for (size_t i = b; i < e; ++i) {
+            char* dst = out + i * row;
+            detail::write_iso8601_row(values[i], dst, p);
+            dst[len] = separator;
+        }
+    });
+    return values.size() * row;
+}
+
+/**
+ * @brief Render a column of timestamps into fixed-size slots
+ * @param values Datetimes to render
+ * @param out Buffer of at least values.size() * stride.bytes bytes
+ * @param stride Slot size; bytes past iso8601_length(p) in a slot are left untouched
+ * @param p Fraction digits
+ * @return Number of bytes spanned (values.size() * stride.bytes)
+ * @throw std::invalid_argument if stride.bytes < iso8601_length(p)
+ */
+inline size_t format_iso8601(std::span<const DateTime> values, char* out, Stride stride,
+                             IsoPrecision p = IsoPrecision::Milliseconds) {
+    if (stride.bytes < iso8601_length(p)) {
+        throw std::invalid_argument("Stride shorter than ISO 8601 row");
+    }
+    size_t workers = detail::worker_count(values.size(), 1u << 16);
+    detail::parallel_chunks(values.size(), workers, [&](size_t b, size_t e, size_t) {
+        for (size_t i = b; i < e; ++i) detail::write_iso8601_row(values[i], out + i * stride.bytes, p);
+    });
+    return values.size() * stride.bytes;
+}
+
+} // namespace zuu
@@ -0,0 +1,425 @@
+/**
+ * @file leap_seconds.hpp
+ * @brief Leap second table and UTC / TAI / GPS time scale conversions
+ * @author zuudevs (zuudevs@gmail.com)
+ * @version 1.1.1
+ * @date 2026-10-16
+ */
+
+#pragma once
+
+#include "datetime_core.hpp"
+#include "datetime_parallel.hpp"
+#include <algorithm>
+#include <fstream>
+#include <optional>
+#include <span>
+#include <sstream>
+#include <stdexcept>
+#include <string>
+#include <string_view>
+#include <vector>
+
+namespace zuu {
+
+namespace detail {
+
+    constexpr int64_t NANOS_PER_SECOND_I64 = NANOS_PER_SECOND;
+
+    /// Seconds from the NTP epoch (1900-01-01) to the Unix epoch
+    constexpr int64_t NTP_UNIX_OFFSET = 2'208'988'800;
+
+    /// GPS epoch 1980-01-06T00:00:00 UTC as Unix seconds
+    constexpr int64_t GPS_EPOCH_UNIX = 315'964'800;
+
+    /// TAI - GPS, fixed since the GPS epoch
+    constexpr int64_t TAI_MINUS_GPS = 19;
+
+    /// Built-in leap second history: first day with the new TAI - UTC
+    struct LeapRecord {
+        int16_t year;
+        int8_t month;
+        int8_t tai_minus_utc;
+    };
+
+    constexpr std::array<LeapRecord, 28> LEAP_SECONDS = {{
+        {1972, 1, 10}, {1972, 7, 11}, {1973, 1, 12}, {1974, 1, 13}, {1975, 1, 14},
+        {1976, 1, 15}, {1977, 1, 16}, {1978, 1, 17}, {1979, 1, 18}, {1980, 1, 19},
+        {1981, 7, 20}, {1982, 7, 21}, {1983, 7, 22}, {1985, 7, 23}, {1988, 1, 24},
+        {1990, 1, 25}, {1991, 1, 26}, {1992, 7, 27}, {1993, 7, 28}, {1994, 7, 29},
+        {1996, 1, 30}, {1997, 7, 31}, {1999, 1, 32}, {2006, 1, 33}, {2009, 1, 34},
+        {2012, 7, 35}, {2015, 7, 36}, {2017, 1, 37}
+    }};
+
+} // namespace detail
+
+// ============================================================================
+// 23:59:60
+// ============================================================================
+
+/**
+ * @struct LeapDateTime
+ * @brief UTC datetime that can also name an inserted leap second
+ *
+ * @details DateTime cannot hold second 60. While leap_second is set,
+ * datetime holds 23:59:59.fff of the same day and the value denotes
+ * 23:59:60.fff.
+ */
+struct LeapDateTime {
+    DateTime datetime;          ///< Value, or 23:59:59.fff during a leap second
+    bool leap_second = false;   ///< true for 23:59:60.fff
+
+    /**
+     * @brief Create from components, accepting second 60 at 23:59
+     * @throw std::out_of_range if components are invalid
+     */
+    [[nodiscard]] static constexpr LeapDateTime make(int y, int m, int d, int h, int min, int s, int ns = 0) {
+        if (s == 60) {
+            if (h != 23 || min != 59) throw std::out_of_range("Leap second outside 23:59");
+            return LeapDateTime{DateTime(y, m, d, h, min, 59, ns), true};
+        }
+        return LeapDateTime{DateTime(y, m, d, h, min, s, ns), false};
+    }
+
+    /**
+     * @brief Get second component [0-60]
+     */
+    [[nodiscard]] constexpr int second() const noexcept { return datetime.second() + leap_second; }
+
+    /**
+     * @brief Format as ISO 8601 with nanoseconds ("2016-12-31T23:59:60.500000000")
+     */
+    [[nodiscard]] std::string to_iso8601_ns() const {
+        std::string s = datetime.to_iso8601_ns();
+        if (leap_second) {
+            s[17] = '6';
+            s[18] = '0';
+        }
+        return s;
+    }
+
+    [[nodiscard]] constexpr bool operator==(const LeapDateTime& other) const noexcept = default;
+};
+
+// ============================================================================
+// Leap Second Table
+// ============================================================================
+
+/**
+ * @class LeapSecondTable
+ * @brief Sorted history of TAI - UTC offsets
+ *
+ * @details Before the first entry the first offset applies (10 s before
+ * 1972 for the built-in table, as CLOCK_TAI does); the rubber-second era
+ * is not modelled. Positive and negative leap seconds are both supported,
+ * though only positive ones have occurred.
+ */
+class LeapSecondTable {
+public:
+    /**
+     * @brief Segment of constant TAI - UTC
+     */
+    struct Entry {
+        int64_t utc = 0;             ///< Unix seconds at which the offset takes effect
+        int64_t tai = 0;             ///< Same instant on the TAI scale (utc + offset)
+        int32_t tai_minus_utc = 0;   ///< Offset in seconds from then on
+    };
+
+private:
+    std::vector<Entry> entries_;
+    int64_t expires_ = 0;
+
+    void push(int64_t utc, int32_t offset) {
+        entries_.push_back({utc, utc + offset, offset});
+    }
+
+public:
+    /**
+     * @brief Table compiled into the library
+     * @note Current as of IERS Bulletin C 70 (no leap second through 2026-06-28);
+     * load the tzdata leap-seconds.list for later data.
+     */
+    [[nodiscard]] static const LeapSecondTable& builtin() {
+        static const LeapSecondTable table = [] {
+            LeapSecondTable t;
+            for (const auto& r : detail::LEAP_SECONDS) {
+                t.push(int64_t{days_from_civil(r.year, r.month, 1)} * detail::SECONDS_PER_DAY, r.tai_minus_utc);
+            }
+            t.expires_ = int64_t{days_from_civil(2026, 6, 28)} * detail::SECONDS_PER_DAY;
+            return t;
+        }();
+        return table;
+    }
+
+    /**
+     * @brief Parse the contents of an IERS/tzdata leap-seconds.list file
+     * @param text File contents ("<NTP seconds> <TAI-UTC> # comment" lines, "#@ <NTP expiry>")
+     * @return Table, or std::nullopt if a data line is malformed or the file has no entries
+     */
+    [[nodiscard]] static std::optional<LeapSecondTable> parse(std::string_view text) {
+        LeapSecondTable t;
+        std::istringstream in{std::string(text)};
+        std::string line;
+        while (std::getline(in, line)) {
+            if (line.rfind("#@", 0) == 0) {
+                std::istringstream fields(line.substr(2));
+                int64_t ntp = 0;
+                if (fields >> ntp) t.expires_ = ntp - detail::NTP_UNIX_OFFSET;
+                continue;
+            }
+            line = line.substr(0, line.find('#'));
+            if (line.find_first_not_of(" \t\r") == std::string::npos) continue;
+            std::istringstream fields(line);
+            int64_t ntp = 0;
+            int32_t offset = 0;
+            if (!(fields >> ntp >> offset)) return std::nullopt;
+            int64_t utc = ntp - detail::NTP_UNIX_OFFSET;
+            if (!t.entries_.empty() && utc <= t.entries_.back().utc) return std::nullopt;
+            t.push(utc, offset);
+        }
+        if (t.entries_.empty()) return std::nullopt;
+        return t;
+    }
+
+    /**
+     * @brief Load a leap-seconds.list file (e.g. /usr/share/zoneinfo/leap-seconds.list)
+     * @throw std::runtime_error if the file cannot be read or parsed
+     */
+    [[nodiscard]] static LeapSecondTable from_file(const std::string& path) {
+        std::ifstream file(path);
+        if (!file) throw std::runtime_error("Cannot open leap second file: " + path);
+        std::stringstream buffer;
+        buffer << file.rdbuf();
+        auto table = parse(buffer.str());
+        if (!table) throw std::runtime_error("Malformed leap second file: " + path);
+        return *table;
+    }
+
+    /**
+     * @brief Get all entries, oldest first
+     */
+    [[nodiscard]] const std::vector<Entry>& entries() const noexcept { return entries_; }
+
+    /**
+     * @brief Get the instant after which the table is no longer guaranteed complete
+     */
+    [[nodiscard]] DateTime expires() const noexcept { return DateTime::from_unix_timestamp(expires_); }
+
+    /**
+     * @brief Index of the segment containing a UTC instant, or -1 before the first entry
+     * @param utc Unix seconds (a leap second shares the number of the 23:59:59 before it)
+     */
+    [[nodiscard]] ptrdiff_t find_utc(int64_t utc) const noexcept {
+        auto it = std::upper_bound(entries_.begin(), entries_.end(), utc,
+                                   [](int64_t v, const Entry& e) { return v < e.utc; });
+        return (it - entries_.begin()) - 1;
+    }
+
+    /**
+     * @brief Index of the segment containing a TAI instant, or -1 before the first entry
+     * @param tai TAI seconds since 1970-01-01T00:00:00 TAI
+     */
+    [[nodiscard]] ptrdiff_t find_tai(int64_t tai) const noexcept {
+        auto it = std::upper_bound(entries_.begin(), entries_.end(), tai,
+                                   [](int64_t v, const Entry& e) { return v < e.tai; });
+        return (it - entries_.begin()) - 1;
+    }
+
+    /**
+     * @brief TAI - UTC in seconds at a UTC instant
+     */
+    [[nodiscard]] int32_t tai_minus_utc(int64_t utc) const noexcept {
+        ptrdiff_t i = find_utc(utc);
+        return entries_[i < 0 ? 0 : static_cast<size_t>(i)].tai_minus_utc;
+    }
+
+    /**
+     * @brief Check if a UTC day ends with an inserted leap second (23:59:60)
+     */
+    [[nodiscard]] bool has_leap_second(const Date& day) const noexcept {
+        int64_t next = (int64_t{day.to_unix_days()} + 1) * detail::SECONDS_PER_DAY;
+        ptrdiff_t i = find_utc(next);
+        return i > 0 && entries_[static_cast<size_t>(i)].utc == next &&
+               entries_[static_cast<size_t>(i)].tai_minus_utc > entries_[static_cast<size_t>(i) - 1].tai_minus_utc;
+    }
+};
+
+// ============================================================================
+// Conversions
+// ============================================================================
+
+/**
+ * @class TimeScaleConverter
+ * @brief UTC <-> TAI <-> GPS conversions with a cached segment
+ *
+ * @details Each converter remembers the constant-offset segment of the last
+ * UTC and TAI lookup, so runs of nearby timestamps (capture files, clock
+ * reads) convert in O(1) with two compares; other values fall back to a
+ * binary search of the table. TAI is counted in nanoseconds since
+ * 1970-01-01T00:00:00 TAI (the CLOCK_TAI convention), GPS in nanoseconds
+ * since 1980-01-06T00:00:00 UTC. The cache makes a converter unsuitable for
+ * sharing between threads; create one per thread.
+ */
+class TimeScaleConverter {
+private:
+    const LeapSecondTable* table_;
+    int64_t utc_lo_ = 1, utc_hi_ = 0;   ///< Cached UTC segment [lo, hi) in seconds
+    int64_t utc_off_ = 0;
+    int64_t tai_lo_ = 1, tai_hi_ = 0;   ///< Cached TAI segment [lo, hi), leap gap excluded
+    int64_t tai_off_ = 0;
+
+    static constexpr int64_t LOWEST = INT64_MIN / 2;
+    static constexpr int64_t HIGHEST = INT64_MAX / 2;
+
+    void load_utc(int64_t utc) noexcept {
+        const auto& e = table_->entries();
+        ptrdiff_t i = table_->find_utc(utc);
+        size_t next = static_cast<size_t>(i + 1);
+        utc_lo_ = i < 0 ? LOWEST : e[static_cast<size_t>(i)].utc;
+        utc_hi_ = next < e.size() ? e[next].utc : HIGHEST;
+        utc_off_ = table_->tai_minus_utc(utc);
+    }
+
+    void load_tai(int64_t tai) noexcept {
+        const auto& e = table_->entries();
+        ptrdiff_t i = table_->find_tai(tai);
+        size_t next = static_cast<size_t>(i + 1);
+        tai_off_ = e[i < 0 ? 0 : static_cast<size_t>(i)].tai_minus_utc;
+        tai_lo_ = i < 0 ? LOWEST : e[static_cast<size_t>(i)].tai;
+        // The segment ends where UTC reaches the next entry under the old offset,
+        // or earlier where the next entry starts after a negative leap second
+        tai_hi_ = next < e.size() ? std::min(e[next].utc + tai_off_, e[next].tai) : HIGHEST;
+    }
+
+public:
+    /**
+     * @brief Bind to a leap second table (must outlive the converter)
+     */
+    explicit TimeScaleConverter(const LeapSecondTable& table = LeapSecondTable::builtin()) noexcept
+        : table_(&table) {}
+
+    /**
+     * @brief UTC to TAI
+     * @param utc UTC datetime; a leap flag on a day without a leap second
+     *        reads as 00:00:00 of the next day
+     * @return TAI nanoseconds since 1970-01-01T00:00:00 TAI
+     */
+    [[nodiscard]] int64_t utc_to_tai(const LeapDateTime& utc) noexcept {
+        int64_t ns = utc.datetime.to_unix_nanos();
+        int64_t secs = detail::floor_div(ns, detail::NANOS_PER_SECOND_I64);
+        if (secs < utc_lo_ || secs >= utc_hi_) load_utc(secs);
+        return ns + (utc_off_ + utc.leap_second) * detail::NANOS_PER_SECOND_I64;
+    }
+
+    /**
+     * @brief UTC Unix nanoseconds to TAI
+     */
+    [[nodiscard]] int64_t utc_to_tai(int64_t unix_nanos) noexcept {
+        int64_t secs = detail::floor_div(unix_nanos, detail::NANOS_PER_SECOND_I64);
+        if (secs < utc_lo_ || secs >= utc_hi_) load_utc(secs);
+        return unix_nanos + utc_off_ * detail::NANOS_PER_SECOND_I64;
+    }
+
+    /**
+     * @brief TAI to UTC, yielding 23:59:60 inside an inserted leap second
+     * @param tai TAI nanoseconds since 1970-01-01T00:00:00 TAI
+     */
+    [[nodiscard]] LeapDateTime tai_to_utc(int64_t tai) noexcept {
+        int64_t secs = detail::floor_div(tai, detail::NANOS_PER_SECOND_I64);
+        if (secs < tai_lo_ || secs >= tai_hi_) {
+            load_tai(secs);
+            if (secs >= tai_hi_) {
+                // Inside the leap second: hold 23:59:59 and flag it
+                int64_t ns = tai - (tai_off_ + (secs - tai_hi_) + 1) * detail::NANOS_PER_SECOND_I64;
+                return LeapDateTime{DateTime::from_unix_nanos(ns), true};
+            }
+        }
+        return LeapDateTime{DateTime::from_unix_nanos(tai - tai_off_ * detail::NANOS_PER_SECOND_I64), false};
+    }
+
+    /**
+     * @brief TAI to UTC Unix nanoseconds (a leap second repeats 23:59:59, as POSIX clocks do)
+     */
+    [[nodiscard]] int64_t tai_to_unix_nanos(int64_t tai) noexcept {
+        return tai_to_utc(tai).datetime.to_unix_nanos();
+    }
+
+    /**
+     * @brief GPS nanoseconds to TAI nanoseconds
+     */
+    [[nodiscard]] static constexpr int64_t gps_to_tai(int64_t gps) noexcept {
+        return gps + (detail::GPS_EPOCH_UNIX + detail::TAI_MINUS_GPS) * detail::NANOS_PER_SECOND_I64;
+    }
+
+    /**
+     * @brief TAI nanoseconds to GPS nanoseconds
+     */
+    [[nodiscard]] static constexpr int64_t tai_to_gps(int64_t tai) noexcept {
+        return tai - (detail::GPS_EPOCH_UNIX + detail::TAI_MINUS_GPS) * detail::NANOS_PER_SECOND_I64;
+    }
+
+    /**
+     * @brief UTC to GPS nanoseconds since the GPS epoch
+     */
+    [[nodiscard]] int64_t utc_to_gps(const LeapDateTime& utc) noexcept { return tai_to_gps(utc_to_tai(utc)); }
+
+    /**
+     * @brief GPS nanoseconds to UTC
+     */
+    [[nodiscard]] LeapDateTime gps_to_utc(int64_t gps) noexcept { return tai_to_utc(gps_to_tai(gps)); }
+};
+
+// ============================================================================
+// Batch Conversion
+// ============================================================================
+
+/**
+ * @brief Convert GPS timestamps (e.g. from a capture file) to UTC
+ * @param gps Nanoseconds since the GPS epoch
+ * @param out UTC values (same length); leap seconds come out as 23:59:60
+ * @param table Leap second table
+ * @note Large spans are split across threads, one cached converter each
+ */
+inline void gps_to_utc(std::span<const int64_t> gps, std::span<LeapDateTime> out,
+                       const LeapSecondTable& table = LeapSecondTable::builtin()) {
+    size_t n = std::min(gps.size(), out.size());
+    size_t workers = detail::worker_count(n, 1u << 16);
+    detail::parallel_chunks(n, workers, [&](size_t b, size_t e, size_t) {
+        TimeScaleConverter conv(table);
+        for (size_t i = b; i < e; ++i) out[i] = conv.gps_to_utc(gps[i]);
+    });
+}
+
+/**
+ * @brief Convert TAI timestamps to UTC Unix nanoseconds
+ * @param tai Nanoseconds since 1970-01-01T00:00:00 TAI
+ * @param out Unix nanoseconds (same length); a leap second repeats 23:59:59
+ * @param table Leap second table
+ */
+inline void tai_to_unix_nanos(std::span<const int64_t> tai, std::span<int64_t> out,
+                              const LeapSecondTable& table = LeapSecondTable::builtin()) {
+    size_t n = std::min(tai.size(), out.size());
+    size_t workers = detail::worker_count(n, 1u << 16);
+    detail::parallel_chunks(n, workers, [&](size_t b, size_t e, size_t) {
+        TimeScaleConverter conv(table);
+        for (size_t i = b; i < e; ++i) out[i] = conv.tai_to_unix_nanos(tai[i]);
+    });
+}
+
+/**
+ * @brief Convert UTC Unix nanoseconds to TAI
+ * @param unix_nanos UTC Unix nanoseconds
+ * @param out TAI nanoseconds (same length)
+ * @param table Leap second table
+ */
+inline void unix_nanos_to_tai(std::span<const int64_t> unix_nanos, std::span<int64_t> out,
+                              const LeapSecondTable& table = LeapSecondTable::builtin()) {
+    size_t n = std::min(unix_nanos.size(), out.size());
+    size_t workers = detail::worker_count(n, 1u << 16);
+    detail::parallel_chunks(n, workers, [&](size_t b, size_t e, size_t) {
+        TimeScaleConverter conv(table);
+        for (size_t i = b; i < e; ++i) out[i] = conv.utc_to_tai(unix_nanos[i]);
+    });
+}
+
+} // namespace zuu
@@ -0,0 +1,167 @@
+/**
+ * @file log_timestamp.hpp
+ * @brief Parsers for Common Log Format and syslog (RFC 3164 / RFC 5424) timestamps
+ * @author zuudevs (zuudevs@gmail.com)
+ * @version 1.1.1
+ * @date 2026-10-16
+ */
+
+#pragma once
+
+#include "datetime_core.hpp"
+#include <optional>
+#include <string_view>
+
+namespace zuu {
+
+/**
+ * @struct OffsetDateTime
+ * @brief Wall-clock datetime together with its UTC offset
+ */
+struct OffsetDateTime {
+    DateTime local;               ///< Datetime as written in the log line
+    int32_t offset_minutes = 0;   ///< UTC offset, east of Greenwich positive
+
+    /**
+     * @brief Convert to UTC (local - offset)
+     */
+    [[nodiscard]] constexpr DateTime to_utc() const noexcept {
+        DateTime result = local;
+        result.add_minutes(-offset_minutes);
+        return result;
+    }
+
+    [[nodiscard]] constexpr bool operator==(const OffsetDateTime& other) const noexcept = default;
+};
+
+namespace detail {
+
+    /**
+     * @brief Read a UTC offset "+hhmm" or, with colon, "+hh:mm"
+     * @param s Points at the sign
+     * @return false if malformed or |offset| >= 24h
+     */
+    constexpr bool read_utc_offset(const char* s, bool colon, int32_t& minutes) noexcept {
+        if (s[0] != '+' && s[0] != '-') return false;
+        int h = read_2digits(s + 1);
+        if (colon && s[3] != ':') return false;
+        int m = read_2digits(s + 3 + colon);
+        if (h < 0 || h > 23 || m < 0 || m > 59) return false;
+        minutes = (s[0] == '-' ? -1 : 1) * (h * 60 + m);
+        return true;
+    }
+
+} // namespace detail
+
+// ============================================================================
+// Common Log Format
+// ============================================================================
+
+/**
+ * @brief Parse an Apache/nginx access-log timestamp
+ * @param s "10/Oct/2000:13:55:36 -0700", optionally enclosed in brackets
+ * @return Local datetime and offset, or std::nullopt if malformed
+ * @note Fixed layout; the month is decoded with a perfect-hash lookup.
+ * Second 60 is accepted only when the local time is 23:59 UTC once the
+ * offset is removed (e.g. "15:59:60 -0800"), and is read as :59.
+ */
+[[nodiscard]] constexpr std::optional<OffsetDateTime> parse_clf_timestamp(std::string_view s) noexcept {
+    if (s.size() == 28 && s.front() == '[' && s.back() == ']') s = s.substr(1, 26);
+    if (s.size() != 26) return std::nullopt;
+
+    const char* p = s.data();
+    int h = 0, m = 0, sec = 0;
+    int32_t offset = 0;
+    if (p[2] != '/' || p[6] != '/' || p[11] != ':' || p[20] != ' ' ||
+        !detail::read_hms(p + 12, h, m, sec) || !detail::read_utc_offset(p + 21, false, offset)) {
+        return std::nullopt;
+    }
+    int year = detail::read_4digits(p + 7);
+    int month = detail::month_from_abbrev(p + 3);
+    int day = detail::read_2digits(p);
+    if (month == 0 || !is_valid_date(year, month, day) || !detail::fold_leap_second(h, m, sec, offset)) {
+        return std::nullopt;
+    }
+    return OffsetDateTime{DateTime(unchecked, year, month, day, h, m, sec), offset};
+}
+
+// ============================================================================
+// Syslog
+// ============================================================================
+
+/**
+ * @brief Parse a BSD syslog (RFC 3164) timestamp
+ * @param s "Oct 11 22:14:15" (day padded with a space or a zero)
+ * @param reference Datetime the line was received at, used to infer the year
+ * @return Local datetime, or std::nullopt if malformed
+ *
+ * @details RFC 3164 carries neither year nor offset. The year is the one
+ * that puts the month within six months of the reference, so a "Dec 31"
+ * line received in January belongs to the previous year. The offset is
+ * reported as 0; the sender's zone is unknown, so second 60 is accepted
+ * only at 23:59:60 and read as 23:59:59.
+ */
+[[nodiscard]] constexpr std::optional<OffsetDateTime> parse_rfc3164_timestamp(
+    std::string_view s, const DateTime& reference) noexcept {
+    if (s.size() != 15) return std::nullopt;
+
+    const char* p = s.data();
+    int h = 0, m = 0, sec = 0;
+    if (p[3] != ' ' || p[6] != ' ' || !detail::read_hms(p + 7, h, m, sec)) return std::nullopt;
+    int month = detail::month_from_abbrev(p);
+    char day_digits[2] = {p[4] == ' ' ? '0' : p[4], p[5]};
+    int day = detail::read_2digits(day_digits);
+
+    int delta = month - reference.month();
+    int year = reference.year() - (delta > 6) + (delta < -6);
+    if (month == 0 || !is_valid_date(year, month, day) || !detail::fold_leap_second(h, m, sec)) {
+        return std::nullopt;
+    }
+    return OffsetDateTime{DateTime(unchecked, year, month, day, h, m, sec), 0};
+}
+
+/**
+ * @brief Parse an RFC 5424 syslog timestamp (RFC 3339 profile)
+ * @param s "2003-10-11T22:14:15.003Z" or "2003-08-24T05:14:15.000003-07:00"
+ * @return Local datetime and offset, or std::nullopt if malformed or NILVALUE ("-")
+ * @note Up to nine fraction digits are kept (RFC 5424 itself allows six).
+ * Second 60 is accepted only at 23:59 UTC after removing the offset, and
+ * is read as :59 with the fraction kept.
+ */
+[[nodiscard]] constexpr std::optional<OffsetDateTime> parse_rfc5424_timestamp(std::string_view s) noexcept {
+    if (s.size() < 20) return std::nullopt;
+
+    const char* p = s.data();
+    int h = 0, m = 0, sec = 0;
+    if (p[4] != '-' || p[7] != '-' || p[10] != 'T' || !detail::read_hms(p + 11, h, m, sec)) {
+        return std::nullopt;
+    }
+
+    size_t pos = 19;
+    int nanos = 0;
+    if (p[pos] == '.') {
+        size_t first = ++pos;
+        while (pos < s.size() && static_cast<unsigned>(p[pos]) - '0' <= 9) {
+            if (pos - first < 9) nanos = nanos * 10 + (p[pos] - '0');
+            ++pos;
+        }
+        size_t digits = pos - first;
+        if (digits == 0 || digits > 9) return std::nullopt;
+        for (; digits < 9; ++digits) nanos *= 10;
+    }
+
+    int32_t offset = 0;
+    if (pos + 1 == s.size() && p[pos] == 'Z') {
+        offset = 0;
+    } else if (pos + 6 != s.size() || !detail::read_utc_offset(p + pos, true, offset)) {
+        return std::nullopt;
+    }
+
+    int year = detail::read_4digits(p);
+    int month = detail::read_2digits(p + 5);
+    int day = detail::read_2digits(p + 8);
+    if (!is_valid_date(year, month, day) || !detail::fold_leap_second(h, m, sec, offset)) return std::nullopt;
+    return OffsetDateTime{DateTime(unchecked, year, month, day, h, m, sec, nanos), offset};
+}
+
+} // namespace zuu
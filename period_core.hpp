@@ -0,0 +1,241 @@
+/**
+ * @file period_core.hpp
+ * @brief Calendar period (years, months, days, nanoseconds) and its application
+ * @author zuudevs (zuudevs@gmail.com)
+ * @version 1.1.1
+ * @date 2026-10-16
+ */
+
+#pragma once
+
+#include "duration_core.hpp"
+#include "datetime_parallel.hpp"
+#include <span>
+
+namespace zuu {
+
+/**
+ * @struct Period
+ * @brief Calendar-aware amount of time
+ *
+ * @details
+ * Unlike Duration, a Period's months and years have no fixed length:
+ * 2024-01-31 + 1 month is 2024-02-29. Applying a period performs, in one
+ * pass, the same steps as add_years() + add_months() + add_days() +
+ * add_nanoseconds():
+ * 1. Shift by years * 12 + months, clamping the day to the month length
+ * 2. Shift by days plus any whole days carried out of nanos
+ * 3. Add the remaining nanoseconds to the time of day
+ *
+ * Results outside 0001-01-01 .. 9999-12-31 are clamped to that range.
+ */
+struct Period {
+    int32_t years = 0;    ///< Calendar years
+    int32_t months = 0;   ///< Calendar months
+    int32_t days = 0;     ///< Calendar days
+    int64_t nanos = 0;    ///< Exact nanoseconds (time of day part)
+
+    /**
+     * @brief Create a period from an exact duration (nanoseconds only)
+     */
+    [[nodiscard]] static constexpr Period from_duration(Duration d) noexcept {
+        return Period{0, 0, 0, d.total_nanoseconds()};
+    }
+
+    /**
+     * @brief Fold years into months and whole days out of nanos
+     * @return Equivalent period with years == 0 and |nanos| < 1 day
+     * @note The sums are taken in 64 bits; months and days saturate at the
+     * int32 range, which is far beyond 0001..9999 in either direction, so
+     * applying the result still gives the same (clamped) datetime.
+     */
+    [[nodiscard]] constexpr Period normalized() const noexcept {
+        constexpr int64_t ns_per_day = static_cast<int64_t>(detail::NANOS_PER_DAY);
+        return Period{0, saturate32(int64_t{years} * 12 + months),
+                      saturate32(int64_t{days} + nanos / ns_per_day),
+                      nanos % ns_per_day};
+    }
+
+    /**
+     * @brief Check if period is empty
+     */
+    [[nodiscard]] constexpr bool is_zero() const noexcept {
+        return years == 0 && months == 0 && days == 0 && nanos == 0;
+    }
+
+    /**
+     * @brief Component-wise negation
+     */
+    [[nodiscard]] constexpr Period operator-() const noexcept {
+        return Period{-years, -months, -days, -nanos};
+    }
+
+    /**
+     * @brief Component-wise sum
+     */
+    [[nodiscard]] constexpr Period operator+(const Period& other) const noexcept {
+        return Period{years + other.years, months + other.months,
+                      days + other.days, nanos + other.nanos};
+    }
+
+    /**
+     * @brief Component-wise equality
+     */
+    [[nodiscard]] constexpr bool operator==(const Period& other) const noexcept = default;
+
+    /**
+     * @brief Format as ISO 8601 period (e.g. "P1Y2M3DT4H5M6.5S")
+     * @note Components keep their sign, e.g. "P-1M" or "P1DT-1H-30M"
+     */
+    [[nodiscard]] std::string to_iso8601() const {
+        std::string result = "P";
+        if (years) { result += std::to_string(years); result += 'Y'; }
+        if (months) { result += std::to_string(months); result += 'M'; }
+        if (days) { result += std::to_string(days); result += 'D'; }
+        if (nanos || result.size() == 1) {
+            // Reuse Duration's "PT..." rendering, dropping its sign and "P"
+            std::string t = Duration(nanos).to_iso8601();
+            if (nanos < 0) {
+                // Sign every time component like the date ones: "-PT1H30M" -> "T-1H-30M"
+                result += 'T';
+                bool component_start = true;
+                for (char c : std::string_view(t).substr(3)) {
+                    if (component_start) result += '-';
+                    result += c;
+                    component_start = c == 'H' || c == 'M';
+                }
+            } else {
+                result += t.substr(1);
+            }
+        }
+        return result;
+    }
+
+private:
+    static constexpr int32_t saturate32(int64_t v) noexcept {
+        return v < INT32_MIN ? INT32_MIN : (v > INT32_MAX ? INT32_MAX : static_cast<int32_t>(v));
+    }
+};
+
+namespace detail {
+
+    /**
+     * @brief Exact normalised steps of a period, in 64 bits
+     */
+    struct PeriodSteps {
+        int64_t months = 0;   ///< years * 12 + months
+        int64_t days = 0;     ///< days plus whole days of nanos
+        int64_t nanos = 0;    ///< Remaining nanoseconds, |nanos| < 1 day
+
+        /**
+         * @param p Period to apply
+         * @param negate Steps for subtracting p (also exact for INT32_MIN components)
+         */
+        constexpr PeriodSteps(const Period& p, bool negate = false) noexcept {
+            constexpr int64_t ns_per_day = static_cast<int64_t>(NANOS_PER_DAY);
+            const int64_t sign = negate ? -1 : 1;
+            months = sign * (int64_t{p.years} * 12 + p.months);
+            days = sign * (int64_t{p.days} + p.nanos / ns_per_day);
+            nanos = sign * (p.nanos % ns_per_day);
+        }
+    };
+
+    /**
+     * @brief Apply a normalized period to a datetime (branch-light kernel)
+     * @param dt Datetime to shift
+     * @param months Total months (years folded in)
+     * @param days Total days (whole days of nanos folded in)
+     * @param nanos Remaining nanoseconds, |nanos| < 1 day
+     */
+    constexpr DateTime apply_period(const DateTime& dt, int64_t months, int64_t days, int64_t nanos) noexcept {
+        constexpr int64_t ns_per_day = static_cast<int64_t>(NANOS_PER_DAY);
+        constexpr int64_t min_month = 0;
+        constexpr int64_t max_month = static_cast<int64_t>(MAX_YEAR) * 12 - 1;
+
+        // Month step: months counted from 0001-01, clamped like Date::add_months
+        int64_t m_index = (dt.year() - 1) * int64_t{12} + (dt.month() - 1) + months;
+        m_index = m_index < min_month ? min_month : (m_index > max_month ? max_month : m_index);
+        int year = static_cast<int>(m_index / 12) + 1;
+        int month = static_cast<int>(m_index % 12) + 1;
+        int dim = DAYS_PER_MONTH[month - 1] + ((month == 2) & is_leap_year(year));
+        int day = dt.day() < dim ? dt.day() : dim;
+
+        // Time step with day carry
+        int64_t tod = static_cast<int64_t>(dt.get_time().total_nanoseconds()) + nanos;
+        int64_t carry = (tod >= ns_per_day) - (tod < 0);
+        tod -= carry * ns_per_day;
+
+        // Day step: stay inside the month when possible, else go through
+        // the serial day number
+        int64_t new_day = day + days + carry;
+        if (new_day >= 1 && new_day <= dim) {
+            return DateTime(Date(unchecked, year, month, static_cast<int>(new_day)), Time(unchecked, static_cast<uint64_t>(tod)));
+        }
+        int64_t serial = days_from_civil(year, month, day) + days + carry;
+        if (serial < MIN_UNIX_DAYS) return DateTime(Date(unchecked, MIN_YEAR, 1, 1));
+        if (serial > MAX_UNIX_DAYS) return DateTime(Date(unchecked, MAX_YEAR, 12, 31), Time(unchecked, NANOS_PER_DAY - 1));
+
+        CivilDate c = civil_from_days(static_cast<int32_t>(serial));
+        return DateTime(Date(unchecked, c.year, c.month, c.day), Time(unchecked, static_cast<uint64_t>(tod)));
+    }
+
+} // namespace detail
+
+// ============================================================================
+// Period Application
+// ============================================================================
+
+/**
+ * @brief Shift a datetime by a calendar period in a single pass
+ * @param dt Datetime to shift
+ * @param p Period to apply
+ * @return Shifted datetime (clamped to the supported year range)
+ */
+[[nodiscard]] constexpr DateTime apply(const DateTime& dt, const Period& p) noexcept {
+    detail::PeriodSteps n(p);
+    return detail::apply_period(dt, n.months, n.days, n.nanos);
+}
+
+/**
+ * @brief Shift every datetime in a span by the same period, in place
+ * @param values Datetimes to shift
+ * @param p Period to apply
+ *
+ * @details The period is normalised once; the per-element kernel is
+ * branch-light integer arithmetic with no validation loops. Large spans
+ * are split across hardware threads.
+ * @note Call as zuu::apply(); an unqualified call with a std::span argument
+ * also finds std::apply through argument-dependent lookup.
+ */
+inline void apply(std::span<DateTime> values, const Period& p) {
+    if (p.is_zero()) return;
+    detail::PeriodSteps n(p);
+    int64_t months = n.months, days = n.days, nanos = n.nanos;
+    size_t workers = detail::worker_count(values.size(), 1u << 18);
+    detail::parallel_chunks(values.size(), workers, [&](size_t b, size_t e, size_t) {
+        DateTime* data = values.data();
+        for (size_t i = b; i < e; ++i) {
+            data[i] = detail::apply_period(data[i], months, days, nanos);
+        }
+    });
+}
+
+/**
+ * @brief Shift a datetime forward by a period
+ */
+[[nodiscard]] constexpr DateTime operator+(const DateTime& dt, const Period& p) noexcept {
+    return apply(dt, p);
+}
+
+/**
+ * @brief Shift a datetime backward by a period
+ */
+[[nodiscard]] constexpr DateTime operator-(const DateTime& dt, const Period& p) noexcept {
+    detail::PeriodSteps n(p, true);
+    return detail::apply_period(dt, n.months, n.days, n.nanos);
+}
+
+constexpr DateTime& operator+=(DateTime& dt, const Period& p) noexcept { return dt = dt + p; }
+constexpr DateTime& operator-=(DateTime& dt, const Period& p) noexcept { return dt = dt - p; }
+
+} // namespace zuu
@@ -0,0 +1,357 @@
+/**
+ * @file rounding.hpp
+ * @brief floor / ceil / round of Time and DateTime to durations and calendar units
+ * @author zuudevs (zuudevs@gmail.com)
+ * @version 1.1.1
+ * @date 2026-10-16
+ */
+
+#pragma once
+
+#include "datetime_core.hpp"
+#include "duration_core.hpp"
+#include <algorithm>
+#include <span>
+#include <stdexcept>
+
+namespace zuu {
+
+/**
+ * @brief Calendar unit for rounding
+ */
+enum class CalendarUnit : uint8_t {
+    Day,       ///< Midnight
+    Week,      ///< Monday 00:00 (ISO 8601)
+    Month,     ///< First of the month
+    Quarter,   ///< Jan 1, Apr 1, Jul 1, Oct 1
+    Year       ///< Jan 1
+};
+
+namespace detail {
+
+    enum class RoundMode : uint8_t { Floor, Ceil, Nearest };
+
+    /// (a * b) mod m for 0 <= a, b < m
+    constexpr uint64_t mul_mod(uint64_t a, uint64_t b, uint64_t m) noexcept {
+#if defined(__SIZEOF_INT128__)
+        return static_cast<uint64_t>(static_cast<unsigned __int128>(a) * b % m);
+#else
+        uint64_t r = 0;
+        while (b) {
+            if (b & 1) r = (r >= m - a) ? r - (m - a) : r + a;
+            a = (a >= m - a) ? a - (m - a) : a + a;
+            b >>= 1;
+        }
+        return r;
+#endif
+    }
+
+    constexpr int64_t checked_step(const Duration& step) {
+        int64_t s = step.total_nanoseconds();
+        if (s <= 0) throw std::invalid_argument("Rounding step must be positive");
+        return s;
+    }
+
+    /// Whether the result is one step above the floor
+    constexpr bool round_up(RoundMode mode, uint64_t rem, uint64_t step) noexcept {
+        if (rem == 0) return false;
+        return mode == RoundMode::Ceil || (mode == RoundMode::Nearest && rem >= step - rem);
+    }
+
+    constexpr Time round_time(const Time& t, uint64_t step, RoundMode mode) noexcept {
+        uint64_t tod = t.total_nanoseconds();
+        uint64_t rem = tod % step;
+        uint64_t out = tod - rem;
+        if (round_up(mode, rem, step)) {
+            out += step;
+            if (out >= NANOS_PER_DAY) out = 0;   // wraps like Time::add_nanoseconds
+        }
+        return Time(unchecked, out);
+    }
+
+    /// dt moved to serial day `days` at `tod`; unchanged if days is outside 0001..9999
+    constexpr DateTime place(const DateTime& dt, int64_t days, uint64_t tod) noexcept {
+        if (days < MIN_UNIX_DAYS || days > MAX_UNIX_DAYS) return dt;
+        return DateTime(Date::from_unix_days(static_cast<int32_t>(days)), Time(unchecked, tod));
+    }
+
+    /// Grid of multiples of step since 1970-01-01T00:00
+    constexpr DateTime round_datetime(const DateTime& dt, uint64_t step, RoundMode mode) noexcept {
+        const uint64_t tod = dt.get_time().total_nanoseconds();
+        const int64_t days = dt.get_date().to_unix_days();
+
+        // Step divides the day (15 s, 5 min, 1 h, ...): one modulo on the time of day
+        if (NANOS_PER_DAY % step == 0) {
+            uint64_t rem = tod % step;
+            uint64_t out = tod - rem;
+            if (!round_up(mode, rem, step)) return DateTime(dt.get_date(), Time(unchecked, out));
+            out += step;
+            if (out < NANOS_PER_DAY) return DateTime(dt.get_date(), Time(unchecked, out));
+            return place(dt, days + 1, 0);
+        }
+
+        // Whole days (1 d, 7 d, ...): one floor-modulo on the serial day
+        if (step % NANOS_PER_DAY == 0) {
+            int64_t k = static_cast<int64_t>(step / NANOS_PER_DAY);
+            int64_t day_rem = days - floor_div(days, k) * k;
+            uint64_t rem = static_cast<uint64_t>(day_rem) * NANOS_PER_DAY + tod;
+            return place(dt, days - day_rem + (round_up(mode, rem, step) ? k : 0), 0);
+        }
+
+        // Anything else: position on the grid without forming the (possibly overflowing) epoch nanos
+        uint64_t day_mod = static_cast<uint64_t>(days - floor_div(days, static_cast<int64_t>(step)) * static_cast<int64_t>(step));
+        uint64_t rem = (mul_mod(day_mod, NANOS_PER_DAY % step, step) + tod % step) % step;
+        uint64_t delta = round_up(mode, rem, step) ? step : 0;
+        // Move back by rem to the floor, then forward by delta, in whole days plus time of day
+        int64_t back_days = static_cast<int64_t>(rem / NANOS_PER_DAY);
+        uint64_t back_tod = rem % NANOS_PER_DAY;
+        int64_t d = days - back_days;
+        uint64_t t = tod;
+        if (t < back_tod) { --d; t += NANOS_PER_DAY; }
+        t -= back_tod;
+        d += static_cast<int64_t>(delta / NANOS_PER_DAY);
+        t += delta % NANOS_PER_DAY;
+        if (t >= NANOS_PER_DAY) { ++d; t -= NANOS_PER_DAY; }
+        return place(dt, d, t);
+    }
+
+    /// First day of the unit containing d
+    constexpr Date unit_start(const Date& d, CalendarUnit unit) noexcept {
+        switch (unit) {
+            case CalendarUnit::Day: return d;
+            case CalendarUnit::Week: return Date(d).add_days(-d.day_of_week());
+            case CalendarUnit::Month: return Date(unchecked, d.year(), d.month(), 1);
+            case CalendarUnit::Quarter: return Date(unchecked, d.year(), (d.month() - 1) / 3 * 3 + 1, 1);
+            case CalendarUnit::Year: return Date(unchecked, d.year(), 1, 1);
+        }
+        return d;
+    }
+
+    /// Calendar rounding from the fields alone; no serial-day round trip
+    constexpr DateTime round_datetime(const DateTime& dt, CalendarUnit unit, RoundMode mode) noexcept {
+        const Date& d = dt.get_date();
+        const int y = d.year(), m = d.month();
+        const Date start = unit_start(d, unit);
+        int64_t into = 0;   // whole days from start to d
+        int64_t len = 1;    // days in the unit
+        switch (unit) {
+            case CalendarUnit::Day: break;
+            case CalendarUnit::Week: into = d.day_of_week(); len = 7; break;
+            case CalendarUnit::Month: into = d.day() - 1; len = days_in_month(m, y); break;
+            case CalendarUnit::Quarter: {
+                const int first = start.month();
+                into = d.day() - 1;
+                for (int i = first; i < m; ++i) into += days_in_month(i, y);
+                len = days_in_month(first, y) + days_in_month(first + 1, y) + days_in_month(first + 2, y);
+                break;
+            }
+            case CalendarUnit::Year: into = d.day_of_year() - 1; len = is_leap_year(y) ? 366 : 365; break;
+        }
+
+        const uint64_t rem = static_cast<uint64_t>(into) * NANOS_PER_DAY + dt.get_time().total_nanoseconds();
+        if (rem == 0 || mode == RoundMode::Floor) return DateTime(start);
+        if (mode == RoundMode::Nearest && rem < static_cast<uint64_t>(len) * NANOS_PER_DAY - rem) return DateTime(start);
+
+        // Start of the next unit; past 9999-12-31 the value is left unchanged
+        switch (unit) {
+            case CalendarUnit::Day:
+            case CalendarUnit::Week: {
+                Date next = start;
+                next.add_days(static_cast<int32_t>(len));
+                return next == start ? dt : DateTime(next);
+            }
+            case CalendarUnit::Month:
+            case CalendarUnit::Quarter: {
+                int next_month = start.month() + (unit == CalendarUnit::Month ? 1 : 3);
+                if (next_month <= 12) return DateTime(Date(unchecked, y, next_month, 1));
+                break;
+            }
+            case CalendarUnit::Year: break;
+        }
+        return y < MAX_YEAR ? DateTime(Date(unchecked, y + 1, 1, 1)) : dt;
+    }
+
+    /// Grid of multiples of step; results beyond the int64 range saturate
+    constexpr int64_t round_nanos(int64_t ns, int64_t step, RoundMode mode) noexcept {
+        int64_t rem = ns % step;
+        if (rem < 0) rem += step;
+        int64_t out = 0;
+        if (round_up(mode, static_cast<uint64_t>(rem), static_cast<uint64_t>(step))) {
+            if (add_overflow(ns, step - rem, out)) return std::numeric_limits<int64_t>::max();
+        } else if (sub_overflow(ns, rem, out)) {
+            return std::numeric_limits<int64_t>::min();
+        }
+        return out;
+    }
+
+    template <typename T, typename Step>
+    size_t round_span(std::span<const T> in, std::span<T> out, const Step& step, RoundMode mode) {
+        if (out.size() < in.size()) throw std::invalid_argument("Output span is too small");
+        if constexpr (std::is_same_v<Step, CalendarUnit>) {
+            for (size_t i = 0; i < in.size(); ++i) out[i] = round_datetime(in[i], step, mode);
+        } else {
+            const int64_t s = checked_step(step);
+            if constexpr (std::is_same_v<T, int64_t>) {
+                for (size_t i = 0; i < in.size(); ++i) out[i] = round_nanos(in[i], s, mode);
+            } else if constexpr (std::is_same_v<T, Time>) {
+                for (size_t i = 0; i < in.size(); ++i) out[i] = round_time(in[i], static_cast<uint64_t>(s), mode);
+            } else {
+                for (size_t i = 0; i < in.size(); ++i) out[i] = round_datetime(in[i], static_cast<uint64_t>(s), mode);
+            }
+        }
+        return in.size();
+    }
+
+} // namespace detail
+
+// ============================================================================
+// Time (grid anchored at midnight)
+// ============================================================================
+
+/**
+ * @brief Round down to a multiple of step since midnight
+ * @throw std::invalid_argument if step is not positive
+ */
+[[nodiscard]] constexpr Time floor(const Time& t, const Duration& step) {
+    return detail::round_time(t, static_cast<uint64_t>(detail::checked_step(step)), detail::RoundMode::Floor);
+}
+
+/**
+ * @brief Round up to a multiple of step since midnight; wraps to 00:00 past the last one
+ * @throw std::invalid_argument if step is not positive
+ */
+[[nodiscard]] constexpr Time ceil(const Time& t, const Duration& step) {
+    return detail::round_time(t, static_cast<uint64_t>(detail::checked_step(step)), detail::RoundMode::Ceil);
+}
+
+/**
+ * @brief Round to the nearest multiple of step since midnight (ties round up)
+ * @throw std::invalid_argument if step is not positive
+ */
+[[nodiscard]] constexpr Time round(const Time& t, const Duration& step) {
+    return detail::round_time(t, static_cast<uint64_t>(detail::checked_step(step)), detail::RoundMode::Nearest);
+}
+
+// ============================================================================
+// DateTime (grid anchored at 1970-01-01T00:00)
+// ============================================================================
+
+/**
+ * @brief Round down to a multiple of step since the Unix epoch
+ * @throw std::invalid_argument if step is not positive
+ *
+ * @details Steps that divide a day cost one modulo on the time of day;
+ * whole-day steps one modulo on the serial day. Results outside
+ * 0001..9999 leave the value unchanged.
+ *
+ * @code
+ * auto bucket = zuu::floor(sample_time, zuu::Duration::from_minutes(5));
+ * @endcode
+ */
+[[nodiscard]] constexpr DateTime floor(const DateTime& dt, const Duration& step) {
+    return detail::round_datetime(dt, static_cast<uint64_t>(detail::checked_step(step)), detail::RoundMode::Floor);
+}
+
+/**
+ * @brief Round up to a multiple of step since the Unix epoch
+ * @throw std::invalid_argument if step is not positive
+ */
+[[nodiscard]] constexpr DateTime ceil(const DateTime& dt, const Duration& step) {
+    return detail::round_datetime(dt, static_cast<uint64_t>(detail::checked_step(step)), detail::RoundMode::Ceil);
+}
+
+/**
+ * @brief Round to the nearest multiple of step since the Unix epoch (ties round up)
+ * @throw std::invalid_argument if step is not positive
+ */
+[[nodiscard]] constexpr DateTime round(const DateTime& dt, const Duration& step) {
+    return detail::round_datetime(dt, static_cast<uint64_t>(detail::checked_step(step)), detail::RoundMode::Nearest);
+}
+
+/**
+ * @brief Start of the calendar unit containing dt
+ */
+[[nodiscard]] constexpr DateTime floor(const DateTime& dt, CalendarUnit unit) noexcept {
+    return detail::round_datetime(dt, unit, detail::RoundMode::Floor);
+}
+
+/**
+ * @brief dt if it starts a calendar unit, otherwise the start of the next one
+ */
+[[nodiscard]] constexpr DateTime ceil(const DateTime& dt, CalendarUnit unit) noexcept {
+    return detail::round_datetime(dt, unit, detail::RoundMode::Ceil);
+}
+
+/**
+ * @brief Nearer of floor(dt, unit) and ceil(dt, unit) (ties round up)
+ */
+[[nodiscard]] constexpr DateTime round(const DateTime& dt, CalendarUnit unit) noexcept {
+    return detail::round_datetime(dt, unit, detail::RoundMode::Nearest);
+}
+
+/**
+ * @brief First day of the calendar unit containing d
+ */
+[[nodiscard]] constexpr Date floor(const Date& d, CalendarUnit unit) noexcept { return detail::unit_start(d, unit); }
+
+/**
+ * @brief d if it starts a calendar unit, otherwise the first day of the next one
+ */
+[[nodiscard]] constexpr Date ceil(const Date& d, CalendarUnit unit) noexcept {
+    return ceil(DateTime(d), unit).get_date();
+}
+
+// ============================================================================
+// Batch
+// ============================================================================
+
+/**
+ * @brief Round every element of in into out (in and out may be the same span)
+ * @return Number of values written (in.size())
+ * @throw std::invalid_argument if out is smaller than in or step is not positive
+ *
+ * @details The int64_t overloads round nanoseconds since the Unix epoch.
+ * A multiple of step that falls outside the int64 range saturates to
+ * INT64_MIN / INT64_MAX, so floor(INT64_MIN) with a step of 3 ns is INT64_MIN.
+ */
+inline size_t floor(std::span<const DateTime> in, std::span<DateTime> out, const Duration& step) {
+    return detail::round_span(in, out, step, detail::RoundMode::Floor);
+}
+inline size_t ceil(std::span<const DateTime> in, std::span<DateTime> out, const Duration& step) {
+    return detail::round_span(in, out, step, detail::RoundMode::Ceil);
+}
+inline size_t round(std::span<const DateTime> in, std::span<DateTime> out, const Duration& step) {
+    return detail::round_span(in, out, step, detail::RoundMode::Nearest);
+}
+
+inline size_t floor(std::span<const DateTime> in, std::span<DateTime> out, CalendarUnit unit) {
+    return detail::round_span(in, out, unit, detail::RoundMode::Floor);
+}
+inline size_t ceil(std::span<const DateTime> in, std::span<DateTime> out, CalendarUnit unit) {
+    return detail::round_span(in, out, unit, detail::RoundMode::Ceil);
+}
+inline size_t round(std::span<const DateTime> in, std::span<DateTime> out, CalendarUnit unit) {
+    return detail::round_span(in, out, unit, detail::RoundMode::Nearest);
+}
+
+inline size_t floor(std::span<const Time> in, std::span<Time> out, const Duration& step) {
+    return detail::round_span(in, out, step, detail::RoundMode::Floor);
+}
+inline size_t ceil(std::span<const Time> in, std::span<Time> out, const Duration& step) {
+    return detail::round_span(in, out, step, detail::RoundMode::Ceil);
+}
+inline size_t round(std::span<const Time> in, std::span<Time> out, const Duration& step) {
+    return detail::round_span(in, out, step, detail::RoundMode::Nearest);
+}
+
+inline size_t floor(std::span<const int64_t> in, std::span<int64_t> out, const Duration& step) {
+    return detail::round_span(in, out, step, detail::RoundMode::Floor);
+}
+inline size_t ceil(std::span<const int64_t> in, std::span<int64_t> out, const Duration& step) {
+    return detail::round_span(in, out, step, detail::RoundMode::Ceil);
+}
+inline size_t round(std::span<const int64_t> in, std::span<int64_t> out, const Duration& step) {
+    return detail::round_span(in, out, step, detail::RoundMode::Nearest);
+}
+
+} // namespace zuu
@@ -0,0 +1,198 @@
+/**
+ * @file streaming_formatter.hpp
+ * @brief Formatter that re-renders only the fields that changed since the last call
+ * @author zuudevs (zuudevs@gmail.com)
+ * @version 1.1.1
+ * @date 2026-10-16
+ */
+
+#pragma once
+
+#include "datetime_core.hpp"
+#include "format_pattern.hpp"
+#include "iso8601_batch.hpp"
+#include <string>
+#include <string_view>
+#include <vector>
+
+namespace zuu {
+
+/**
+ * @class StreamingFormatter
+ * @brief Stateful formatter for streams of nearby timestamps (e.g. log lines)
+ *
+ * @details
+ * Keeps the text of the last value it rendered. When the next value falls
+ * on the same day, every field before the first changed unit is already
+ * correct and only the hour, minute, second or fraction fields (fixed
+ * width) are rewritten in place; weekday, week number and names are not
+ * recomputed. A new day renders the whole pattern once.
+ *
+ * Output is identical to DateTime::format() with the same pattern. Values
+ * need not be monotonic; going back in time just costs a fuller render.
+ *
+ * @code
+ * zuu::StreamingFormatter fmt("%Y-%m-%d %H:%M:%S.%f");
+ * for (const auto& event : events) {
+ *     line.clear();
+ *     fmt.append_to(event.time, line);
+ *     ...
+ * }
+ * @endcode
+ */
+class StreamingFormatter {
+private:
+    using Op = FormatPattern::Op;
+
+    /// What a step depends on; a change at one level dirties all later ones
+    enum class Level : uint8_t { Literal, Date, Hour, Minute, Second, Fraction };
+
+    /// A fixed-width time field inside the cached text
+    struct TimeSlot {
+        uint32_t offset;
+        Op op;
+        Level level;
+    };
+
+    FormatPattern pattern_;
+    std::vector<TimeSlot> time_slots_;
+    std::string text_;
+    Date last_date_;
+    uint32_t last_secs_ = 0;      ///< Second of day of the cached value
+    uint32_t last_frac_ = 0;      ///< Nanosecond of second of the cached value
+    bool primed_ = false;
+
+    static constexpr Level level_of(Op op) noexcept {
+        switch (op) {
+            case Op::Literal: return Level::Literal;
+            case Op::Hour: return Level::Hour;
+            case Op::Minute: return Level::Minute;
+            case Op::Second: return Level::Second;
+            case Op::Milli:
+            case Op::Micro:
+            case Op::Nano: return Level::Fraction;
+            default: return Level::Date;
+        }
+    }
+
+    /// Write value as exactly `width` digits starting at p (width <= 9)
+    static void put_digits(char* p, uint32_t value, uint32_t width) noexcept {
+        if (width == 9) {
+            *p++ = static_cast<char>('0' + value / 100'000'000);
+            value %= 100'000'000;
+            width = 8;
+        }
+        uint64_t digits = detail::digits8_to_ascii(value) >> (8 * (8 - width));
+        if constexpr (std::endian::native == std::endian::big) digits = __builtin_bswap64(digits);
+        std::memcpy(p, &digits, width);
+    }
+
+    /// Rewrite the time fields at or below `dirty` in place
+    void rewrite(Level dirty, uint32_t secs, uint32_t frac) noexcept {
+        char* text = text_.data();
+        for (const auto& slot : time_slots_) {
+            if (slot.level < dirty) continue;
+            char* p = text + slot.offset;
+            switch (slot.op) {
+                case Op::Hour: put_digits(p, secs / 3600, 2); break;
+                case Op::Minute: put_digits(p, secs / 60 % 60, 2); break;
+                case Op::Second: put_digits(p, secs % 60, 2); break;
+                case Op::Milli: put_digits(p, frac / detail::NANOS_PER_MILLISECOND, 3); break;
+                case Op::Micro: put_digits(p, frac / detail::NANOS_PER_MICROSECOND, 6); break;
+                case Op::Nano: put_digits(p, frac, 9); break;
+                default: break;
+            }
+        }
+    }
+
+    /// Render every step from scratch, recording where the time fields landed
+    void render_all(const Date& d, uint32_t secs, uint32_t frac) {
+        text_.clear();
+        time_slots_.clear();
+        for (const auto& step : pattern_.steps()) {
+            uint32_t start = static_cast<uint32_t>(text_.size());
+            switch (step.op) {
+                case Op::Literal: text_ += pattern_.literal(step); break;
+                case Op::Year: detail::append_4digits(text_, d.year()); break;
+                case Op::Month: detail::append_2digits(text_, d.month()); break;
+                case Op::Day: detail::append_2digits(text_, d.day()); break;
+                case Op::Weekday: text_ += static_cast<char>('0' + d.day_of_week()); break;
+                case Op::DayOfYear: text_.append(3, '0'); put_digits(text_.data() + start, d.day_of_year(), 3); break;
+                case Op::Quarter: text_ += static_cast<char>('0' + d.quarter()); break;
+                case Op::Week: detail::append_2digits(text_, d.week_number()); break;
+                case Op::MonthName: text_ += detail::MONTH_NAMES[d.month() - 1]; break;
+                case Op::MonthAbbrev: text_ += detail::MONTH_ABBREV[d.month() - 1]; break;
+                case Op::WeekdayName: text_ += detail::WEEKDAY_NAMES[d.day_of_week()]; break;
+                case Op::WeekdayAbbrev: text_ += detail::WEEKDAY_ABBREV[d.day_of_week()]; break;
+                case Op::Hour:
+                case Op::Minute:
+                case Op::Second: text_.append(2, '0'); break;
+                case Op::Milli: text_.append(3, '0'); break;
+                case Op::Micro: text_.append(6, '0'); break;
+                case Op::Nano: text_.append(9, '0'); break;
+            }
+            if (level_of(step.op) > Level::Date) time_slots_.push_back({start, step.op, level_of(step.op)});
+        }
+        rewrite(Level::Hour, secs, frac);
+    }
+
+    /// Bring the cached text up to date with dt
+    void update(const DateTime& dt) {
+        uint64_t tod = dt.get_time().total_nanoseconds();
+        uint32_t secs = static_cast<uint32_t>(tod / detail::NANOS_PER_SECOND);
+        uint32_t frac = static_cast<uint32_t>(tod % detail::NANOS_PER_SECOND);
+        if (!primed_ || dt.get_date() != last_date_) {
+            render_all(dt.get_date(), secs, frac);
+        } else if (secs != last_secs_) {
+            rewrite(secs / 60 == last_secs_ / 60 ? Level::Second
+                  : secs / 3600 == last_secs_ / 3600 ? Level::Minute : Level::Hour, secs, frac);
+        } else if (frac != last_frac_) {
+            rewrite(Level::Fraction, secs, frac);
+        }
+        last_date_ = dt.get_date();
+        last_secs_ = secs;
+        last_frac_ = frac;
+        primed_ = true;
+    }
+
+public:
+    /**
+     * @brief Bind to a format string (compiled once)
+     * @param fmt Format string using the same specifiers as DateTime::format()
+     */
+    explicit StreamingFormatter(std::string_view fmt) : pattern_(fmt) {}
+
+    /**
+     * @brief Bind to an already compiled pattern
+     */
+    explicit StreamingFormatter(FormatPattern pattern) : pattern_(std::move(pattern)) {}
+
+    /**
+     * @brief Format a datetime
+     * @return View of the rendered text, valid until the next call
+     */
+    [[nodiscard]] std::string_view format(const DateTime& dt) {
+        update(dt);
+        return text_;
+    }
+
+    /**
+     * @brief Format a datetime and append the text to out
+     */
+    void append_to(const DateTime& dt, std::string& out) {
+        update(dt);
+        out += text_;
+    }
+
+    /**
+     * @brief Get the bound pattern
+     */
+    [[nodiscard]] const FormatPattern& pattern() const noexcept { return pattern_; }
+
+    /**
+     * @brief Forget the cached value; the next call renders everything
+     */
+    void reset() noexcept { primed_ = false; }
+};
+
+} // namespace zuu
@@ -0,0 +1,234 @@
+/**
+ * @file basic_time.cpp
+ * @brief FixedTime / FixedDateTime against std::chrono and DateTime references
+ *
+ * Random tick counts over 0001..9999 at second, millisecond and
+ * microsecond precision, drawn near both range limits, around the epoch
+ * (negative ticks included) and uniformly, are split into date and time
+ * of day and compared with
+ * std::chrono::floor and year_month_day. to<Q>() must be exact and undone
+ * by floor(), floor() must truncate toward the past, and try_make must
+ * agree with the throwing constructors on valid and invalid components.
+ */
+
+#include "test_check.hpp"
+#include "../basic_time.hpp"
+#include <random>
+
+namespace {
+
+using zuu::Date;
+using zuu::DateTime;
+using zuu::FixedDateTime;
+using zuu::FixedTime;
+using zuu::Time;
+using std::chrono::microseconds;
+using std::chrono::milliseconds;
+using std::chrono::nanoseconds;
+using std::chrono::seconds;
+
+constexpr int64_t MIN_DAYS = zuu::detail::MIN_UNIX_DAYS;
+constexpr int64_t MAX_DAYS = zuu::detail::MAX_UNIX_DAYS;
+constexpr int64_t NS_PER_DAY = static_cast<int64_t>(zuu::detail::NANOS_PER_DAY);
+
+std::mt19937_64 rng(48);
+
+int64_t random_in(int64_t lo, int64_t hi) {
+    return lo + static_cast<int64_t>(rng() % static_cast<uint64_t>(hi - lo + 1));
+}
+
+DateTime random_datetime() {
+    const int64_t days = random_in(MIN_DAYS, MAX_DAYS);
+    return DateTime(Date::from_unix_days(static_cast<int32_t>(days)),
+                    Time(zuu::unchecked, static_cast<uint64_t>(random_in(0, NS_PER_DAY - 1))));
+}
+
+/// Tick counts near the range limits, around the epoch and uniformly in between
+template <typename P>
+int64_t random_ticks() {
+    constexpr int64_t tpd = zuu::detail::precision_traits<P>::ticks_per_day;
+    constexpr int64_t lo = MIN_DAYS * tpd;
+    constexpr int64_t hi = (MAX_DAYS + 1) * tpd - 1;
+    switch (rng() % 4) {
+    case 0: return lo + random_in(0, 3 * tpd);
+    case 1: return hi - random_in(0, 3 * tpd);
+    case 2: return random_in(-3 * tpd, 3 * tpd);
+    default: return random_in(lo, hi);
+    }
+}
+
+// ============================================================================
+// Date and time of day
+// ============================================================================
+
+template <typename P>
+void check_split() {
+    constexpr int64_t tpd = zuu::detail::precision_traits<P>::ticks_per_day;
+    for (int i = 0; i < 200000; ++i) {
+        const int64_t ticks = random_ticks<P>();
+        const FixedDateTime<P> fdt(zuu::unchecked, ticks);
+
+        const std::chrono::sys_time<P> tp{P(ticks)};
+        const auto day = std::chrono::floor<std::chrono::days>(tp);
+        const std::chrono::year_month_day ymd(day);
+        const int64_t tod = (tp - day).count();
+
+        const Date d = fdt.get_date();
+        CHECK(d.to_unix_days() == day.time_since_epoch().count());
+        CHECK(d.year() == static_cast<int>(ymd.year()));
+        CHECK(d.month() == static_cast<int>(static_cast<unsigned>(ymd.month())));
+        CHECK(d.day() == static_cast<int>(static_cast<unsigned>(ymd.day())));
+        CHECK(static_cast<int64_t>(fdt.get_time().ticks()) == tod);
+        CHECK(tod >= 0 && tod < tpd);
+
+        CHECK(fdt.to_datetime() == DateTime::from_sys_time(tp));
+        CHECK(fdt.to_sys_time() == tp);
+        CHECK(fdt.to_unix_timestamp() == std::chrono::floor<seconds>(tp).time_since_epoch().count());
+        CHECK(FixedDateTime<P>(fdt.get_date(), fdt.get_time()) == fdt);
+        CHECK(FixedDateTime<P>::from_ticks(ticks) == fdt);
+    }
+
+    // One tick before the epoch is the last tick of 1969-12-31
+    const FixedDateTime<P> before(zuu::unchecked, -1);
+    CHECK(before.get_date() == Date(1969, 12, 31));
+    CHECK(static_cast<int64_t>(before.get_time().ticks()) == tpd - 1);
+    CHECK(before.hour() == 23 && before.minute() == 59 && before.second() == 59);
+    CHECK(before.to_unix_timestamp() == -1);
+
+    // Range limits
+    const FixedDateTime<P> first(zuu::unchecked, MIN_DAYS * tpd);
+    const FixedDateTime<P> last(zuu::unchecked, (MAX_DAYS + 1) * tpd - 1);
+    CHECK(first == FixedDateTime<P>());
+    CHECK(first.to_datetime() == DateTime(1, 1, 1));
+    CHECK(last.get_date() == Date(9999, 12, 31));
+    CHECK(last.hour() == 23 && last.minute() == 59 && last.second() == 59);
+    CHECK_THROWS(FixedDateTime<P>::from_ticks(MIN_DAYS * tpd - 1), std::out_of_range);
+    CHECK_THROWS(FixedDateTime<P>::from_ticks((MAX_DAYS + 1) * tpd), std::out_of_range);
+}
+
+// ============================================================================
+// to<Q>() and floor()
+// ============================================================================
+
+template <typename P, typename Q>
+void check_widen() {
+    using QT = zuu::BasicTime<Q>;
+    using QDT = zuu::BasicDateTime<Q>;
+    constexpr int64_t scale = zuu::detail::precision_traits<Q>::ticks_per_second /
+                              zuu::detail::precision_traits<P>::ticks_per_second;
+    for (int i = 0; i < 100000; ++i) {
+        const FixedDateTime<P> fdt(zuu::unchecked, random_ticks<P>());
+        const QDT wide = fdt.template to<Q>();
+        const FixedTime<P> t = fdt.get_time();
+        const QT wide_time = t.template to<Q>();
+
+        CHECK(wide_time.total_nanoseconds() == t.total_nanoseconds());
+        if constexpr (std::is_same_v<Q, nanoseconds>) {
+            CHECK(wide == fdt.to_datetime());
+            CHECK(FixedDateTime<P>::floor(wide) == fdt);
+            CHECK(FixedTime<P>::floor(wide_time) == t);
+        } else {
+            CHECK(wide.to_datetime() == fdt.to_datetime());
+            CHECK(wide.ticks() == fdt.ticks() * scale);
+            CHECK(static_cast<int64_t>(wide_time.ticks()) == static_cast<int64_t>(t.ticks()) * scale);
+            CHECK(FixedDateTime<P>::floor(wide.to_datetime()) == fdt);
+            CHECK(FixedTime<P>::floor(wide_time.to_time()) == t);
+        }
+    }
+}
+
+template <typename P>
+void check_floor() {
+    constexpr int64_t nanos_per_tick = zuu::detail::precision_traits<P>::nanos_per_tick;
+    for (int i = 0; i < 200000; ++i) {
+        const DateTime dt = random_datetime();
+        const FixedDateTime<P> f = FixedDateTime<P>::floor(dt);
+        const int64_t ns = static_cast<int64_t>(dt.get_time().total_nanoseconds());
+
+        CHECK(f.get_date() == dt.get_date());
+        CHECK(f.get_time().total_nanoseconds() == static_cast<uint64_t>(ns - ns % nanos_per_tick));
+        CHECK(f.to_datetime() <= dt);
+        CHECK(FixedTime<P>::floor(dt.get_time()) == f.get_time());
+
+        // Truncation is toward the past, also before the epoch (ticks < 0)
+        const std::chrono::sys_time<P> tp =
+            std::chrono::sys_days(std::chrono::days(dt.get_date().to_unix_days())) + std::chrono::floor<P>(nanoseconds(ns));
+        CHECK(f.to_sys_time() == tp);
+    }
+
+    const DateTime before(1969, 12, 31, 23, 59, 59, 999999999);
+    CHECK(FixedDateTime<P>::floor(before).ticks() == -1);
+    CHECK(FixedDateTime<seconds>::floor(DateTime(1969, 12, 31, 23, 59, 58, 1)).ticks() == -2);
+    CHECK(FixedDateTime<P>::floor(DateTime(9999, 12, 31, 23, 59, 59, 999999999)).get_date() == Date(9999, 12, 31));
+}
+
+// ============================================================================
+// try_make
+// ============================================================================
+
+template <typename P>
+void check_try_make() {
+    constexpr int64_t tps = zuu::detail::precision_traits<P>::ticks_per_second;
+    for (int i = 0; i < 100000; ++i) {
+        const int y = static_cast<int>(random_in(1, 9999));
+        const int mo = static_cast<int>(random_in(1, 12));
+        const int d = static_cast<int>(random_in(1, zuu::days_in_month(mo, y)));
+        const int h = static_cast<int>(random_in(0, 23));
+        const int mi = static_cast<int>(random_in(0, 59));
+        const int s = static_cast<int>(random_in(0, 59));
+        const int64_t sub = random_in(0, tps - 1);
+
+        const auto t = FixedTime<P>::try_make(h, mi, s, sub);
+        CHECK(t && *t == FixedTime<P>(h, mi, s, sub));
+        CHECK(t && t->hour() == h && t->minute() == mi && t->second() == s && t->subsecond() == sub);
+
+        const auto dt = FixedDateTime<P>::try_make(y, mo, d, h, mi, s, sub);
+        CHECK(dt && *dt == FixedDateTime<P>(y, mo, d, h, mi, s, sub));
+        CHECK(dt && dt->year() == y && dt->month() == mo && dt->day() == d && dt->get_time() == *t);
+    }
+
+    CHECK(FixedTime<P>::try_make(23, 59, 59, tps - 1) == FixedTime<P>(uint64_t(86400 * tps - 1)));
+    CHECK(FixedDateTime<P>::try_make(1, 1, 1) == FixedDateTime<P>());
+    CHECK(FixedDateTime<P>::try_make(9999, 12, 31, 23, 59, 59, tps - 1)->ticks() == (MAX_DAYS + 1) * 86400 * tps - 1);
+
+    struct Bad { int h, mi, s; int64_t sub; };
+    const Bad bad_times[] = {{24, 0, 0, 0}, {-1, 0, 0, 0}, {0, 60, 0, 0}, {0, -1, 0, 0},
+                             {0, 0, 60, 0}, {0, 0, -1, 0}, {0, 0, 0, -1}, {0, 0, 0, tps}};
+    for (const Bad& b : bad_times) {
+        CHECK(!FixedTime<P>::try_make(b.h, b.mi, b.s, b.sub));
+        CHECK(!FixedDateTime<P>::try_make(2024, 1, 1, b.h, b.mi, b.s, b.sub));
+        CHECK_THROWS(FixedTime<P>(b.h, b.mi, b.s, b.sub), std::out_of_range);
+    }
+
+    struct BadDate { int y, mo, d; };
+    const BadDate bad_dates[] = {{0, 12, 31}, {10000, 1, 1}, {1900, 2, 29}, {2023, 2, 29},
+                                 {2024, 4, 31}, {2024, 0, 1}, {2024, 13, 1}, {2024, 1, 0}};
+    for (const BadDate& b : bad_dates) {
+        CHECK(!FixedDateTime<P>::try_make(b.y, b.mo, b.d));
+        CHECK_THROWS(FixedDateTime<P>(b.y, b.mo, b.d), std::out_of_range);
+    }
+    CHECK(FixedDateTime<P>::try_make(2024, 2, 29));
+
+    CHECK_THROWS(FixedTime<P>(uint64_t(86400 * tps)), std::out_of_range);
+}
+
+template <typename P>
+void check_precision() {
+    check_split<P>();
+    check_floor<P>();
+    check_try_make<P>();
+    check_widen<P, nanoseconds>();
+}
+
+} // namespace
+
+int main() {
+    check_precision<seconds>();
+    check_precision<milliseconds>();
+    check_precision<microseconds>();
+    check_widen<seconds, seconds>();
+    check_widen<seconds, milliseconds>();
+    check_widen<seconds, microseconds>();
+    check_widen<milliseconds, microseconds>();
+    return test::finish();
+}
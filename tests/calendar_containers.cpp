@@ -0,0 +1,428 @@
+/**
+ * @file calendar_containers.cpp
+ * @brief DateMap / YearMonthMap and the date_range views against references
+ *
+ * Random writes grow the maps to both sides, including toward
+ * 0001-01-01 (where left growth must clamp) and 9999-12-31. After every
+ * batch the covered range, iteration, find / at / contains, sum over
+ * random ranges and running_total are compared with a std::map holding
+ * the same writes, every uncovered gap reading as zero.
+ *
+ * days, weekdays, months, month_ends and every are compared with dates
+ * built from serial days and 128-bit nanosecond arithmetic, over random
+ * ranges and ranges that run up to 9999-12-31, where stepping past the
+ * last representable date must end the range.
+ */
+
+#include "test_check.hpp"
+#include "../date_map.hpp"
+#include "../date_range.hpp"
+#include <algorithm>
+#include <limits>
+#include <map>
+#include <random>
+#include <ranges>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+namespace {
+
+using zuu::Date;
+using zuu::DateMap;
+using zuu::YearMonthMap;
+
+constexpr int32_t MIN_DAYS = zuu::detail::MIN_UNIX_DAYS;
+constexpr int32_t MAX_DAYS = zuu::detail::MAX_UNIX_DAYS;
+
+std::mt19937_64 rng(46);
+
+int32_t random_in(int32_t lo, int32_t hi) {
+    return lo + static_cast<int32_t>(rng() % static_cast<uint64_t>(int64_t{hi} - lo + 1));
+}
+
+Date day(int32_t unix_days) { return Date::from_unix_days(unix_days); }
+
+/// Reference: written values keyed by slot date, plus the covered slot range
+template <typename Index>
+struct Reference {
+    std::map<Date, int64_t> values;
+
+    void add(const Date& d, int64_t v) { values[Index::normalize(d)] += v; }
+
+    int64_t get(const Date& d) const {
+        auto it = values.find(Index::normalize(d));
+        return it == values.end() ? 0 : it->second;
+    }
+    Date first() const { return values.begin()->first; }
+    Date last() const { return values.rbegin()->first; }
+    bool covers(const Date& d) const {
+        Date n = Index::normalize(d);
+        return !values.empty() && first() <= n && n <= last();
+    }
+};
+
+template <typename Index>
+void compare(const zuu::CalendarMap<int64_t, Index>& map, const Reference<Index>& ref) {
+    CHECK(map.empty() == ref.values.empty());
+    if (ref.values.empty()) return;
+    CHECK(map.first() == ref.first());
+    CHECK(map.last() == ref.last());
+
+    // Iteration visits every slot in order, gaps as zero
+    bool ordered = true;
+    size_t n = 0;
+    Date expected = ref.first();
+    auto written = ref.values.begin();
+    for (auto [date, value] : map) {
+        const bool hit = written != ref.values.end() && written->first == date;
+        ordered = ordered && date == expected && value == (hit ? written->second : 0);
+        if (hit) ++written;
+        expected = Index::next(expected);
+        ++n;
+    }
+    CHECK(ordered);
+    CHECK(n == map.size());
+    CHECK(map.values().size() == map.size());
+    CHECK(Index::index(ref.first(), ref.last()) + 1 == static_cast<int64_t>(map.size()));
+
+    // Point lookups inside, at the edges and outside the range
+    for (int i = 0; i < 50; ++i) {
+        const Date d = i < 2 ? (i == 0 ? ref.first() : ref.last()) : day(random_in(MIN_DAYS, MAX_DAYS));
+        const int64_t* p = map.find(d);
+        CHECK(map.contains(d) == ref.covers(d));
+        CHECK((p != nullptr) == ref.covers(d));
+        if (p) {
+            CHECK(*p == ref.get(d));
+            CHECK(map.at(d) == ref.get(d));
+        } else {
+            CHECK_THROWS(map.at(d), std::out_of_range);
+        }
+    }
+
+    // Range sums, clipped to the covered range, and running totals
+    const auto totals = map.running_total();
+    CHECK(totals.first() == map.first() && totals.last() == map.last());
+    int64_t acc = 0;
+    bool running = true;
+    for (auto [date, value] : map) {
+        acc += value;
+        running = running && totals.at(date) == acc;
+    }
+    CHECK(running);
+    for (int i = 0; i < 20; ++i) {
+        Date a = day(random_in(ref.first().to_unix_days() - 40, ref.last().to_unix_days() + 40));
+        Date b = day(random_in(a.to_unix_days(), ref.last().to_unix_days() + 40));
+        int64_t expected_sum = 0;
+        for (auto it = ref.values.lower_bound(Index::normalize(a)); it != ref.values.end() && it->first <= Index::normalize(b); ++it) {
+            expected_sum += it->second;
+        }
+        CHECK(map.sum(a, b) == expected_sum);
+
+        // totals[b] - totals[a - 1] over the covered part
+        Date lo = std::max(Index::normalize(a), map.first());
+        Date hi = std::min(Index::normalize(b), map.last());
+        if (lo <= hi) {
+            int64_t before = lo == map.first() ? 0 : totals.at(Index::date_at(lo, -1));
+            CHECK(totals.at(hi) - before == expected_sum);
+        }
+    }
+}
+
+// ============================================================================
+// DateMap
+// ============================================================================
+
+/// Random writes in a window that drifts toward `toward`, comparing after each batch
+template <typename Index>
+void grow_toward(int32_t start, int32_t toward, int batches) {
+    zuu::CalendarMap<int64_t, Index> map;
+    Reference<Index> ref;
+    int32_t lo = start, hi = start;
+    for (int b = 0; b < batches; ++b) {
+        // Extend the window by up to twice its width in the drift direction
+        const int32_t width = hi - lo + 1;
+        if (toward < lo) lo = std::max(toward, lo - random_in(1, 2 * width));
+        else hi = std::min(toward, hi + random_in(1, 2 * width));
+        for (int i = random_in(1, 8); i > 0; --i) {
+            const Date d = day(random_in(lo, hi));
+            const int64_t v = random_in(-1000, 1000);
+            map[d] += v;
+            ref.add(d, v);
+        }
+        compare(map, ref);
+    }
+    // The far end itself
+    map[day(toward)] += 7;
+    ref.add(day(toward), 7);
+    compare(map, ref);
+}
+
+void check_date_map() {
+    for (int rep = 0; rep < 5; ++rep) {
+        grow_toward<zuu::detail::DayIndex>(random_in(-5000, 5000), MIN_DAYS, 25);
+        grow_toward<zuu::detail::DayIndex>(random_in(-5000, 5000), MAX_DAYS, 25);
+    }
+    for (int rep = 0; rep < 50; ++rep) {
+        grow_toward<zuu::detail::DayIndex>(MIN_DAYS + random_in(0, 100), MIN_DAYS, 10);
+        grow_toward<zuu::detail::DayIndex>(MAX_DAYS - random_in(0, 100), MAX_DAYS, 10);
+    }
+
+    // Left growth stops at 0001-01-01 even when doubling would overshoot it
+    DateMap<int> m;
+    m[Date(1, 3, 1)] = 1;
+    m[Date(1, 2, 28)] = 2;     // grows by max(1, size)
+    m[Date(1, 1, 2)] = 3;      // room is smaller than the doubling
+    m[Date(1, 1, 1)] = 4;
+    CHECK(m.first() == Date(1, 1, 1) && m.last() == Date(1, 3, 1));
+    CHECK(m.size() == 60);
+    CHECK(m.at(Date(1, 1, 1)) == 4 && m.at(Date(1, 1, 2)) == 3 && m.at(Date(1, 1, 3)) == 0);
+    CHECK(m.at(Date(1, 2, 28)) == 2 && m.at(Date(1, 3, 1)) == 1);
+    CHECK(m.values().front() == 4 && m.values().back() == 1);
+
+    // Both ends of the range in one map
+    DateMap<int> wide;
+    wide[Date(9999, 12, 31)] = 1;
+    wide[Date(1, 1, 1)] = 2;
+    CHECK(wide.size() == static_cast<size_t>(MAX_DAYS - MIN_DAYS + 1));
+    CHECK(wide.sum(Date(1, 1, 1), Date(9999, 12, 31)) == 3);
+    CHECK(wide.running_total().at(Date(9999, 12, 31)) == 3);
+    CHECK(wide.running_total().at(Date(9999, 12, 30)) == 2);
+
+    // Construction, clear and reuse
+    DateMap<int> fixed(Date(2024, 2, 27), Date(2024, 3, 2));
+    CHECK(fixed.size() == 5 && fixed.at(Date(2024, 2, 29)) == 0);
+    CHECK_THROWS(DateMap<int>(Date(2024, 3, 2), Date(2024, 3, 1)), std::invalid_argument);
+    fixed.clear();
+    CHECK(fixed.empty() && !fixed.contains(Date(2024, 2, 29)));
+    fixed[Date(1999, 12, 31)] = 5;
+    CHECK(fixed.size() == 1 && fixed.first() == Date(1999, 12, 31) && fixed.running_total().at(Date(1999, 12, 31)) == 5);
+    CHECK(DateMap<int>().running_total().empty());
+}
+
+// ============================================================================
+// YearMonthMap
+// ============================================================================
+
+void check_year_month_map() {
+    for (int rep = 0; rep < 20; ++rep) {
+        grow_toward<zuu::detail::MonthIndex>(random_in(-5000, 5000), MIN_DAYS, 20);
+        grow_toward<zuu::detail::MonthIndex>(random_in(-5000, 5000), MAX_DAYS, 20);
+    }
+
+    YearMonthMap<int> m;
+    m[Date(2024, 3, 15)] += 1;
+    m[Date(2024, 3, 31)] += 2;
+    m[Date(2023, 11, 1)] += 4;
+    CHECK(m.first() == Date(2023, 11, 1) && m.last() == Date(2024, 3, 1));
+    CHECK(m.size() == 5);
+    CHECK(m.at(Date(2024, 3, 1)) == 3 && m.at(Date(2024, 1, 20)) == 0);
+    CHECK(m.sum(Date(2023, 12, 31), Date(2024, 3, 1)) == 3);
+
+    YearMonthMap<int> edge;
+    edge[Date(1, 6, 30)] = 1;
+    edge[Date(1, 1, 31)] = 2;
+    CHECK(edge.first() == Date(1, 1, 1) && edge.size() == 6);
+    edge[Date(9999, 12, 31)] = 3;
+    CHECK(edge.last() == Date(9999, 12, 1) && edge.size() == 9999 * 12);
+}
+
+// ============================================================================
+// Date range views
+// ============================================================================
+
+static_assert(std::ranges::view<zuu::DateRangeView<zuu::detail::MonthStep>>);
+static_assert(std::ranges::forward_range<zuu::DateRangeView<zuu::detail::WeekdayStep>>);
+static_assert(std::ranges::view<zuu::DateTimeStepView>);
+static_assert(std::ranges::forward_range<zuu::DateTimeStepView>);
+
+/// Random range of up to max_len days; about a quarter end on 9999-12-31
+std::pair<Date, Date> random_range(int32_t max_len) {
+    const int32_t len = random_in(-3, max_len);
+    const int32_t first = rng() % 4 == 0 ? std::max(MIN_DAYS, MAX_DAYS - std::max(len, 0))
+                                         : random_in(MIN_DAYS, MAX_DAYS);
+    return {day(first), day(std::clamp(first + len, MIN_DAYS, MAX_DAYS))};
+}
+
+template <typename View>
+std::vector<Date> collect(const View& view) {
+    std::vector<Date> out;
+    for (Date d : view) out.push_back(d);
+    return out;
+}
+
+void check_day_views() {
+    for (int i = 0; i < 3000; ++i) {
+        const auto [from, to] = random_range(800);
+        std::vector<Date> all, work;
+        for (int32_t s = from.to_unix_days(); s <= to.to_unix_days(); ++s) {
+            all.push_back(day(s));
+            if (day(s).day_of_week() < 5) work.push_back(day(s));
+        }
+        CHECK(collect(zuu::days(from, to)) == all);
+        CHECK(collect(zuu::weekdays(from, to)) == work);
+    }
+
+    // Every day of the supported range, and the weekdays of its last week
+    size_t n = 0;
+    Date prev;
+    bool ascending = true;
+    for (Date d : zuu::days(Date(1, 1, 1), Date(9999, 12, 31))) {
+        ascending = ascending && (n == 0 || d.to_unix_days() == prev.to_unix_days() + 1);
+        prev = d;
+        ++n;
+    }
+    CHECK(ascending);
+    CHECK(n == static_cast<size_t>(MAX_DAYS - MIN_DAYS + 1));
+    CHECK(prev == Date(9999, 12, 31));
+    CHECK(collect(zuu::weekdays(Date(9999, 12, 25), Date(9999, 12, 31))).size() == 5);   // Sat 25 .. Fri 31
+    CHECK(collect(zuu::weekdays(Date(9999, 12, 31), Date(9999, 12, 31))) == std::vector<Date>{Date(9999, 12, 31)});
+    CHECK(collect(zuu::weekdays(Date(2024, 6, 1), Date(2024, 6, 2))).empty());   // a weekend
+    CHECK(collect(zuu::days(Date(2024, 3, 2), Date(2024, 3, 1))).empty());
+    CHECK(zuu::days(Date(1, 1, 1), Date(1, 1, 1)).front() == Date(1, 1, 1));
+}
+
+void check_month_views() {
+    for (int i = 0; i < 3000; ++i) {
+        const auto [from, to] = random_range(rng() % 2 ? 400 : 40000);
+
+        std::vector<Date> same_day, ends;
+        for (int k = 0;; ++k) {
+            const int64_t index = int64_t{from.year()} * 12 + (from.month() - 1) + k;
+            const int y = static_cast<int>(index / 12), m = static_cast<int>(index % 12) + 1;
+            if (y > 9999) break;
+            const Date end(y, m, zuu::days_in_month(m, y));
+            const Date same(y, m, std::min(from.day(), zuu::days_in_month(m, y)));
+            if (same <= to) same_day.push_back(same);
+            if (end <= to) ends.push_back(end);
+            if (same > to && end > to) break;
+        }
+        CHECK(collect(zuu::months(from, to)) == same_day);
+        CHECK(collect(zuu::month_ends(from, to)) == ends);
+    }
+
+    const std::vector<Date> jan31 = {Date(2023, 1, 31), Date(2023, 2, 28), Date(2023, 3, 31), Date(2023, 4, 30)};
+    CHECK(collect(zuu::months(Date(2023, 1, 31), Date(2023, 5, 30))) == jan31);
+    CHECK(collect(zuu::months(Date(2024, 1, 31), Date(2024, 2, 29))).back() == Date(2024, 2, 29));
+
+    // Stepping past December 9999 ends the range
+    CHECK(collect(zuu::months(Date(9999, 10, 31), Date(9999, 12, 31))) ==
+          (std::vector<Date>{Date(9999, 10, 31), Date(9999, 11, 30), Date(9999, 12, 31)}));
+    CHECK(collect(zuu::month_ends(Date(9999, 11, 15), Date(9999, 12, 31))) ==
+          (std::vector<Date>{Date(9999, 11, 30), Date(9999, 12, 31)}));
+    CHECK(collect(zuu::month_ends(Date(1, 1, 1), Date(9999, 12, 31))).size() == 9999 * 12);
+    CHECK(collect(zuu::months(Date(1, 1, 1), Date(9999, 12, 31))).size() == 9999 * 12);
+    CHECK(collect(zuu::month_ends(Date(2024, 2, 1), Date(2024, 2, 28))).empty());
+}
+
+// ============================================================================
+// every
+// ============================================================================
+
+using zuu::DateTime;
+using zuu::Duration;
+using i128 = __int128;
+
+constexpr i128 NS_PER_DAY = static_cast<i128>(zuu::detail::NANOS_PER_DAY);
+
+i128 to_i128(const DateTime& dt) {
+    return i128{dt.get_date().to_unix_days()} * NS_PER_DAY + dt.get_time().total_nanoseconds();
+}
+
+DateTime from_i128(i128 ns) {
+    i128 days = ns / NS_PER_DAY, rem = ns % NS_PER_DAY;
+    if (rem < 0) { --days; rem += NS_PER_DAY; }
+    return DateTime(day(static_cast<int32_t>(days)), zuu::Time(zuu::unchecked, static_cast<uint64_t>(rem)));
+}
+
+int64_t random_step_nanos() {
+    switch (rng() % 8) {
+        case 0: return 1 + static_cast<int64_t>(rng() % 1000);                          // nanoseconds
+        case 1: return 1 + static_cast<int64_t>(rng() % 86'400'000'000'000);            // under a day
+        case 2: return int64_t{86'400'000'000'000} * random_in(1, 28);                   // whole days, carry path
+        case 3: return int64_t{86'400'000'000'000} * random_in(27, 29) + random_in(-1, 1) * int64_t{1'000'000'000};
+        case 4: return int64_t{86'400'000'000'000} * random_in(29, 400) + static_cast<int64_t>(rng() % 86'400'000'000'000);
+        case 5: return int64_t{86'400'000'000'000} * random_in(365, 106'000);            // years, serial path
+        case 6: return int64_t{3'600'000'000'000} * random_in(1, 48);                   // hours
+        default: return std::numeric_limits<int64_t>::max() - static_cast<int64_t>(rng() % 1000);
+    }
+}
+
+void check_every_case(const DateTime& start, const DateTime& last, int64_t step_ns, bool unbounded) {
+    const Duration step = Duration::from_nanoseconds(step_ns);
+    std::vector<DateTime> expected;
+    for (i128 t = to_i128(start); t <= to_i128(last) && expected.size() < 2000; t += step_ns) {
+        expected.push_back(from_i128(t));
+    }
+
+    std::vector<DateTime> got;
+    if (unbounded) {
+        for (DateTime dt : zuu::every(start, step)) {
+            got.push_back(dt);
+            if (got.size() == 2000) break;
+        }
+    } else {
+        for (DateTime dt : zuu::every(start, last, step) | std::views::take(2000)) got.push_back(dt);
+    }
+    ++test::checks;
+    if (got != expected) {
+        const std::string what = "every(" + start.to_iso8601_ns() + ", " + last.to_iso8601_ns() + ", " +
+                                 std::to_string(step_ns) + "ns)";
+        test::fail(__FILE__, __LINE__, what.c_str());
+    }
+}
+
+void check_every() {
+    const DateTime end_of_range(9999, 12, 31, 23, 59, 59, 999999999);
+    for (int i = 0; i < 20000; ++i) {
+        const int64_t step_ns = random_step_nanos();
+        const DateTime start = from_i128(to_i128(DateTime(day(random_in(MIN_DAYS, MAX_DAYS)))) +
+                                         static_cast<int64_t>(rng() % 86'400'000'000'000));
+        switch (rng() % 3) {
+            case 0: {   // a bounded stretch after start
+                const i128 span = static_cast<i128>(step_ns) * random_in(0, 50) + static_cast<int64_t>(rng() % 1000);
+                const DateTime last = from_i128(std::min(to_i128(start) + span, to_i128(end_of_range)));
+                check_every_case(start, last, step_ns, false);
+                break;
+            }
+            case 1: {   // unbounded from the last few steps before 9999-12-31
+                const i128 back = static_cast<i128>(step_ns) * random_in(0, 30) + static_cast<int64_t>(rng() % 1000);
+                const i128 t = std::max(to_i128(end_of_range) - back, to_i128(DateTime(1, 1, 1)));
+                check_every_case(from_i128(t), end_of_range, step_ns, true);
+                break;
+            }
+            default:   // last before start: empty
+                check_every_case(start, from_i128(std::max(to_i128(start) - 1, to_i128(DateTime(1, 1, 1)))), step_ns,
+                                 false);
+                break;
+        }
+    }
+
+    // Steps that end exactly on, or just past, 9999-12-31 23:59:59.999999999
+    const DateTime last_day(9999, 12, 31);
+    CHECK(std::ranges::distance(zuu::every(last_day, Duration::from_nanoseconds(1)) | std::views::take(5)) == 5);
+    std::vector<DateTime> hours;
+    for (DateTime dt : zuu::every(DateTime(9999, 12, 31, 20, 0, 0), Duration::from_hours(1))) hours.push_back(dt);
+    CHECK(hours.size() == 4 && hours.back() == DateTime(9999, 12, 31, 23, 0, 0));
+    std::vector<DateTime> big;
+    for (DateTime dt : zuu::every(DateTime(9999, 11, 22), Duration::from_days(40))) big.push_back(dt);
+    CHECK(big.size() == 1);
+    std::vector<DateTime> month;
+    for (DateTime dt : zuu::every(DateTime(9999, 12, 4, 0, 0, 1), Duration::from_days(28))) month.push_back(dt);
+    CHECK(month.size() == 1);
+    CHECK(zuu::every(end_of_range, Duration::from_nanoseconds(1)).front() == end_of_range);
+
+    CHECK_THROWS(zuu::every(last_day, Duration()), std::invalid_argument);
+    CHECK_THROWS(zuu::every(last_day, Duration::from_nanoseconds(-1)), std::invalid_argument);
+}
+
+} // namespace
+
+int main() {
+    check_date_map();
+    check_year_month_map();
+    check_day_views();
+    check_month_views();
+    check_every();
+    return test::finish();
+}
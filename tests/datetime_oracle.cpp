@@ -0,0 +1,172 @@
+/**
+ * @file datetime_oracle.cpp
+ * @brief Exhaustive differential test of Date/DateTime against std::chrono
+ *
+ * Walks every day from 0001-01-01 to 9999-12-31 and checks serial days,
+ * weekday, day of year, ISO week, day arithmetic, Unix timestamps,
+ * sys_time conversions at day to nanosecond precision, hh_mm_ss and the
+ * format/parse round trip against std::chrono::sys_days and
+ * year_month_day. The range is split across all hardware threads.
+ *
+ * Exits non-zero and prints the first mismatches if anything disagrees.
+ */
+
+#include "../datetime.hpp"
+#include "../datetime_parallel.hpp"
+#include <atomic>
+#include <chrono>
+#include <cstdio>
+#include <mutex>
+#include <string>
+
+namespace {
+
+using namespace std::chrono;
+
+constexpr size_t MAX_REPORTS = 20;
+
+std::atomic<uint64_t> failures{0};
+std::atomic<uint64_t> checks{0};
+std::mutex report_mutex;
+
+void report(sys_days day, const char* what) {
+    if (failures.fetch_add(1, std::memory_order_relaxed) >= MAX_REPORTS) return;
+    year_month_day ymd(day);
+    std::lock_guard<std::mutex> lock(report_mutex);
+    std::fprintf(stderr, "FAIL %05d-%02u-%02u: %s\n", static_cast<int>(ymd.year()),
+                 static_cast<unsigned>(ymd.month()), static_cast<unsigned>(ymd.day()), what);
+}
+
+#define ORACLE_CHECK(cond)                       \
+    do {                                         \
+        ++local_checks;                          \
+        if (!(cond)) report(day, #cond);         \
+    } while (0)
+
+/// Deterministic pseudo-random value for a serial day
+uint64_t mix(int64_t serial) {
+    uint64_t x = static_cast<uint64_t>(serial) * 0x9E3779B97F4A7C15ull;
+    x ^= x >> 31;
+    x *= 0xBF58476D1CE4E5B9ull;
+    return x ^ (x >> 29);
+}
+
+/// ISO 8601 week number computed from the Thursday of the same week
+int oracle_iso_week(sys_days day) {
+    int iso_dow = static_cast<int>(weekday(day).iso_encoding());   // 1=Monday
+    sys_days thursday = day + days(4 - iso_dow);
+    year iso_year = year_month_day(thursday).year();
+    return static_cast<int>((thursday - sys_days(iso_year / January / 1)).count() / 7 + 1);
+}
+
+void check_day(sys_days day, const zuu::FormatPattern& full_pattern, uint64_t& local_checks) {
+    const year_month_day ymd(day);
+    const int y = static_cast<int>(ymd.year());
+    const int m = static_cast<int>(static_cast<unsigned>(ymd.month()));
+    const int d = static_cast<int>(static_cast<unsigned>(ymd.day()));
+    const int32_t serial = static_cast<int32_t>(day.time_since_epoch().count());
+    const uint64_t r = mix(serial);
+
+    // Serial day and chrono interop
+    const zuu::Date date(y, m, d);
+    ORACLE_CHECK(zuu::is_valid_date(y, m, d));
+    ORACLE_CHECK(date.to_unix_days() == serial);
+    ORACLE_CHECK(zuu::Date::from_unix_days(serial) == date);
+    ORACLE_CHECK(date.to_sys_days() == day);
+    ORACLE_CHECK(zuu::Date::from_sys_days(day) == date);
+    ORACLE_CHECK(date.to_year_month_day() == ymd);
+
+    // Calendar fields
+    ORACLE_CHECK(date.day_of_week() == static_cast<int>(weekday(day).iso_encoding()) - 1);
+    ORACLE_CHECK(date.day_of_year() == (day - sys_days(ymd.year() / January / 1)).count() + 1);
+    ORACLE_CHECK(date.week_number() == oracle_iso_week(day));
+    ORACLE_CHECK(date.is_leap_year() == ymd.year().is_leap());
+    ORACLE_CHECK(date.last_day_of_month().day() ==
+                 static_cast<int>(static_cast<unsigned>(year_month_day_last(ymd.year(), month_day_last(ymd.month())).day())));
+
+    // Day arithmetic, including offsets that leave 0001..9999
+    const int32_t offsets[] = {1, -1, 7, -7, 28, -28, 29, -29, 366, -366, 146097, -146097,
+                               static_cast<int32_t>(r % 7'300'000) - 3'650'000};
+    for (int32_t k : offsets) {
+        const int64_t target = static_cast<int64_t>(serial) + k;
+        zuu::Date moved = date;
+        moved.add_days(k);
+        if (target < zuu::detail::MIN_UNIX_DAYS || target > zuu::detail::MAX_UNIX_DAYS) {
+            ORACLE_CHECK(moved == date);
+        } else {
+            ORACLE_CHECK(moved.to_sys_days() == day + days(k));
+            ORACLE_CHECK(moved.days_between(date) == k);
+        }
+    }
+
+    // Unix timestamps
+    const int64_t sec_of_day = static_cast<int64_t>(r % 86400);
+    const int64_t nano = static_cast<int64_t>((r >> 20) % 1'000'000'000);
+    const zuu::DateTime dt(date, zuu::Time(static_cast<uint64_t>(sec_of_day * 1'000'000'000 + nano)));
+    const sys_seconds stamp = sys_seconds(day) + seconds(sec_of_day);
+    ORACLE_CHECK(dt.to_unix_timestamp() == stamp.time_since_epoch().count());
+    ORACLE_CHECK(zuu::DateTime::from_unix_timestamp(stamp.time_since_epoch().count()) ==
+                 zuu::DateTime(date, zuu::Time::from_seconds(sec_of_day)));
+    if (y > 1677 && y < 2262) {   // int64 nanoseconds
+        const sys_time<nanoseconds> ns_stamp = stamp + nanoseconds(nano);
+        ORACLE_CHECK(dt.to_unix_nanos() == ns_stamp.time_since_epoch().count());
+        ORACLE_CHECK(dt.to_sys_time() == ns_stamp);
+        ORACLE_CHECK(zuu::DateTime::from_unix_nanos(ns_stamp.time_since_epoch().count()) == dt);
+    }
+
+    // std::chrono time points at every precision; coarse ones reach beyond int64 nanoseconds
+    const uint64_t micro_tod = static_cast<uint64_t>(sec_of_day * 1'000'000'000 + nano / 1000 * 1000);
+    ORACLE_CHECK(zuu::DateTime::from_sys_time(day) == zuu::DateTime(date));
+    ORACLE_CHECK(zuu::DateTime::from_sys_time(floor<minutes>(stamp)) ==
+                 zuu::DateTime(date, zuu::Time::from_seconds(sec_of_day / 60 * 60)));
+    ORACLE_CHECK(zuu::DateTime::from_sys_time(stamp) == zuu::DateTime(date, zuu::Time::from_seconds(sec_of_day)));
+    ORACLE_CHECK(zuu::DateTime::from_sys_time(stamp + microseconds(nano / 1000)) ==
+                 zuu::DateTime(date, zuu::Time(micro_tod)));
+
+    // Time of day as std::chrono::hh_mm_ss
+    const hh_mm_ss<nanoseconds> hms = dt.get_time().to_hh_mm_ss();
+    ORACLE_CHECK(hms.hours().count() == sec_of_day / 3600);
+    ORACLE_CHECK(hms.minutes().count() == sec_of_day / 60 % 60);
+    ORACLE_CHECK(hms.seconds().count() == sec_of_day % 60);
+    ORACLE_CHECK(hms.subseconds().count() == nano);
+    ORACLE_CHECK(zuu::Time::from_hh_mm_ss(hms) == dt.get_time());
+    ORACLE_CHECK(zuu::Duration::from_chrono(hms.to_duration()).to_chrono() == dt.get_time().to_duration());
+    ORACLE_CHECK(zuu::Time::from_hh_mm_ss(hh_mm_ss<seconds>(seconds(sec_of_day))) == zuu::Time::from_seconds(sec_of_day));
+
+    // Format / parse round trip
+    char expected[32];
+    std::snprintf(expected, sizeof(expected), "%04d-%02d-%02d %02d:%02d:%02d", y, m, d,
+                  static_cast<int>(sec_of_day / 3600), static_cast<int>(sec_of_day / 60 % 60),
+                  static_cast<int>(sec_of_day % 60));
+    const std::string text = dt.format();
+    ORACLE_CHECK(text == expected);
+    ORACLE_CHECK(zuu::DateTime::try_parse(text) == zuu::DateTime(date, zuu::Time::from_seconds(sec_of_day)));
+
+    // Redundant fields (%a %j %W) are cross-checked by the parser
+    const std::string full = dt.format("%Y-%m-%d %H:%M:%S.%N %a %j W%W");
+    ORACLE_CHECK(zuu::DateTime::try_parse(full, full_pattern) == dt);
+}
+
+} // namespace
+
+int main() {
+    const sys_days first = sys_days(year(1) / January / 1);
+    const sys_days last = sys_days(year(9999) / December / 31);
+    const size_t n = static_cast<size_t>((last - first).count()) + 1;
+
+    auto start = steady_clock::now();
+    zuu::detail::parallel_chunks(n, zuu::detail::worker_count(n, 1 << 16), [&](size_t begin, size_t end, size_t) {
+        const zuu::FormatPattern full_pattern("%Y-%m-%d %H:%M:%S.%N %a %j W%W");
+        uint64_t local_checks = 0;
+        for (size_t i = begin; i < end; ++i) {
+            check_day(first + days(static_cast<int64_t>(i)), full_pattern, local_checks);
+        }
+        checks.fetch_add(local_checks, std::memory_order_relaxed);
+    });
+    double seconds_taken = duration<double>(steady_clock::now() - start).count();
+
+    std::printf("%zu days, %llu checks, %llu failures in %.2f s\n", n,
+                static_cast<unsigned long long>(checks.load()),
+                static_cast<unsigned long long>(failures.load()), seconds_taken);
+    return failures.load() == 0 ? 0 : 1;
+}
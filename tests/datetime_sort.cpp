@@ -0,0 +1,169 @@
+/**
+ * @file datetime_sort.cpp
+ * @brief radix_sort against std::stable_sort
+ *
+ * Epoch-nanosecond and DateTime keys are sorted with an index payload and
+ * compared with std::stable_sort of the same (key, index) pairs, so a
+ * payload out of place among equal keys is caught. Inputs cover negative
+ * and int64-limit keys, few distinct keys, a single day, spans of a few
+ * centuries and the full 0001..9999 range (the two-stage path), at sizes
+ * from empty to several 64 Ki-element chunks (one per worker thread).
+ */
+
+#include "test_check.hpp"
+#include "../datetime_sort.hpp"
+#include <algorithm>
+#include <limits>
+#include <random>
+#include <string>
+#include <vector>
+
+namespace {
+
+using zuu::Date;
+using zuu::DateTime;
+using zuu::Time;
+
+constexpr int64_t I64_MIN = std::numeric_limits<int64_t>::min();
+constexpr int64_t I64_MAX = std::numeric_limits<int64_t>::max();
+constexpr int64_t NS_PER_DAY = static_cast<int64_t>(zuu::detail::NANOS_PER_DAY);
+
+const size_t SIZES[] = {0, 1, 2, 3, 17, 256, 1000, 70000, 300000};
+
+std::mt19937_64 rng(31);
+
+int64_t random_in(int64_t lo, int64_t hi) {
+    return lo + static_cast<int64_t>(rng() % (static_cast<uint64_t>(hi) - static_cast<uint64_t>(lo) + 1));
+}
+
+DateTime random_datetime(int64_t first_day, int64_t last_day) {
+    return DateTime(Date::from_unix_days(static_cast<int32_t>(random_in(first_day, last_day))),
+                    Time(zuu::unchecked, static_cast<uint64_t>(random_in(0, NS_PER_DAY - 1))));
+}
+
+/// Sort keys with an index payload and compare with std::stable_sort
+template <typename K>
+void check_against_stable_sort(const std::vector<K>& input) {
+    std::vector<std::pair<K, size_t>> expected(input.size());
+    for (size_t i = 0; i < input.size(); ++i) expected[i] = {input[i], i};
+    std::stable_sort(expected.begin(), expected.end(),
+                     [](const auto& a, const auto& b) { return a.first < b.first; });
+
+    std::vector<K> keys = input;
+    std::vector<size_t> payload(input.size());
+    for (size_t i = 0; i < payload.size(); ++i) payload[i] = i;
+    zuu::radix_sort(std::span<K>(keys), std::span<size_t>(payload));
+
+    bool same = true;
+    for (size_t i = 0; i < input.size(); ++i) {
+        same = same && keys[i] == expected[i].first && payload[i] == expected[i].second;
+    }
+    CHECK(same);
+
+    std::vector<K> alone = input;
+    zuu::radix_sort(std::span<K>(alone));
+    CHECK(alone == keys);
+}
+
+// ============================================================================
+// Epoch nanoseconds
+// ============================================================================
+
+void check_int64() {
+    for (size_t n : SIZES) {
+        std::vector<int64_t> v(n);
+
+        for (auto& x : v) x = static_cast<int64_t>(rng());
+        check_against_stable_sort(v);
+
+        // All negative
+        for (auto& x : v) x = random_in(I64_MIN, -1);
+        check_against_stable_sort(v);
+
+        // Few distinct keys around zero and at the limits
+        const int64_t pool[] = {I64_MIN, I64_MIN + 1, -NS_PER_DAY, -1, 0, 1, NS_PER_DAY, I64_MAX - 1, I64_MAX};
+        for (auto& x : v) x = pool[rng() % std::size(pool)];
+        check_against_stable_sort(v);
+
+        // Only the low bytes vary, so most passes are skipped
+        for (auto& x : v) x = -1'000'000 + random_in(0, 1000);
+        check_against_stable_sort(v);
+
+        // All equal: every pass is skipped and the order must stay put
+        std::fill(v.begin(), v.end(), int64_t{-42});
+        check_against_stable_sort(v);
+
+        // Already sorted and reversed
+        for (auto& x : v) x = random_in(-NS_PER_DAY, NS_PER_DAY);
+        std::sort(v.begin(), v.end());
+        check_against_stable_sort(v);
+        std::reverse(v.begin(), v.end());
+        check_against_stable_sort(v);
+    }
+}
+
+// ============================================================================
+// DateTime
+// ============================================================================
+
+void check_datetime() {
+    constexpr int64_t min_days = zuu::detail::MIN_UNIX_DAYS;
+    constexpr int64_t max_days = zuu::detail::MAX_UNIX_DAYS;
+    constexpr int64_t max_span = zuu::detail::MAX_KEY_DAY_SPAN;
+
+    for (size_t n : SIZES) {
+        std::vector<DateTime> v(n);
+
+        // Full range: two-stage path
+        for (auto& x : v) x = random_datetime(min_days, max_days);
+        check_against_stable_sort(v);
+
+        // Widest span that still fits one key, and one day more
+        for (auto& x : v) x = random_datetime(-100000, -100000 + max_span);
+        if (n >= 2) {
+            v[0] = DateTime(Date::from_unix_days(-100000));
+            v[1] = DateTime(Date::from_unix_days(static_cast<int32_t>(-100000 + max_span)), Time(23, 59, 59, 999999999));
+        }
+        check_against_stable_sort(v);
+        if (n >= 2) v[1] = DateTime(Date::from_unix_days(static_cast<int32_t>(-100000 + max_span + 1)));
+        check_against_stable_sort(v);
+
+        // Before the epoch, within one day, and at the range limits
+        for (auto& x : v) x = random_datetime(-30000, -1);
+        check_against_stable_sort(v);
+        for (auto& x : v) x = random_datetime(-5, -5);
+        check_against_stable_sort(v);
+        const DateTime pool[] = {DateTime(1, 1, 1), DateTime(1, 1, 1, 0, 0, 0, 1), DateTime(1969, 12, 31, 23, 59, 59),
+                                 DateTime(1970, 1, 1), DateTime(9999, 12, 31, 23, 59, 59, 999999999)};
+        for (auto& x : v) x = pool[rng() % std::size(pool)];
+        check_against_stable_sort(v);
+
+        // Duplicates within a narrow window
+        for (auto& x : v) x = DateTime(2024, 2, 29, 12, 0, static_cast<int>(rng() % 4));
+        check_against_stable_sort(v);
+    }
+}
+
+void check_string_payload() {
+    // Non-trivial payloads are moved, not copied or lost
+    std::vector<DateTime> keys(5000);
+    std::vector<std::string> payload(keys.size());
+    for (size_t i = 0; i < keys.size(); ++i) {
+        keys[i] = random_datetime(zuu::detail::MIN_UNIX_DAYS, zuu::detail::MAX_UNIX_DAYS);
+        payload[i] = keys[i].to_iso8601() + " #" + std::to_string(i);
+    }
+    zuu::radix_sort(std::span<DateTime>(keys), std::span<std::string>(payload));
+    CHECK(std::is_sorted(keys.begin(), keys.end()));
+    bool matches = true;
+    for (size_t i = 0; i < keys.size(); ++i) matches = matches && payload[i].starts_with(keys[i].to_iso8601() + " #");
+    CHECK(matches);
+}
+
+} // namespace
+
+int main() {
+    check_int64();
+    check_datetime();
+    check_string_payload();
+    return test::finish();
+}
@@ -0,0 +1,194 @@
+/**
+ * @file duration.cpp
+ * @brief Duration arithmetic at the int64 extremes and ISO 8601 text
+ *
+ * checked_*, saturating_* and the throwing operators are compared with the
+ * same operation in 128-bit arithmetic, on random operands biased towards
+ * min(), max(), 0 and +/-1. ISO 8601 output is parsed back for random and
+ * extreme durations, malformed strings must be rejected, and subtracting
+ * min() from a DateTime must equal adding max() plus one nanosecond.
+ */
+
+#include "test_check.hpp"
+#include "../duration_core.hpp"
+#include <limits>
+#include <random>
+#include <string>
+
+namespace {
+
+using zuu::Duration;
+using zuu::DateTime;
+using i128 = __int128;
+
+constexpr int64_t I64_MIN = std::numeric_limits<int64_t>::min();
+constexpr int64_t I64_MAX = std::numeric_limits<int64_t>::max();
+
+std::mt19937_64 rng(28);
+
+int64_t random_value() {
+    switch (rng() % 12) {
+        case 0: return I64_MIN;
+        case 1: return I64_MAX;
+        case 2: return I64_MIN + static_cast<int64_t>(rng() % 4);
+        case 3: return I64_MAX - static_cast<int64_t>(rng() % 4);
+        case 4: return static_cast<int64_t>(rng() % 5) - 2;
+        case 5: return static_cast<int64_t>(rng() >> 32) - (int64_t{1} << 31);
+        default: return static_cast<int64_t>(rng());
+    }
+}
+
+bool fits(i128 v) { return v >= I64_MIN && v <= I64_MAX; }
+
+int64_t saturate(i128 v) { return v < I64_MIN ? I64_MIN : (v > I64_MAX ? I64_MAX : static_cast<int64_t>(v)); }
+
+void check_arithmetic(int64_t a, int64_t b) {
+    const Duration da(a), db(b);
+
+    const i128 sum = i128{a} + b, diff = i128{a} - b, prod = i128{a} * b;
+    CHECK(da.checked_add(db).has_value() == fits(sum));
+    CHECK(da.checked_sub(db).has_value() == fits(diff));
+    CHECK(da.checked_mul(b).has_value() == fits(prod));
+    if (fits(sum)) CHECK(da.checked_add(db)->total_nanoseconds() == static_cast<int64_t>(sum));
+    if (fits(diff)) CHECK(da.checked_sub(db)->total_nanoseconds() == static_cast<int64_t>(diff));
+    if (fits(prod)) CHECK(da.checked_mul(b)->total_nanoseconds() == static_cast<int64_t>(prod));
+
+    CHECK(da.saturating_add(db).total_nanoseconds() == saturate(sum));
+    CHECK(da.saturating_sub(db).total_nanoseconds() == saturate(diff));
+    CHECK(da.saturating_mul(b).total_nanoseconds() == saturate(prod));
+
+    if (fits(sum)) CHECK((da + db).total_nanoseconds() == static_cast<int64_t>(sum));
+    else CHECK_THROWS(da + db, std::overflow_error);
+    if (fits(diff)) CHECK((da - db).total_nanoseconds() == static_cast<int64_t>(diff));
+    else CHECK_THROWS(da - db, std::overflow_error);
+    if (fits(prod)) CHECK((da * b).total_nanoseconds() == static_cast<int64_t>(prod));
+    else CHECK_THROWS(da * b, std::overflow_error);
+
+    const bool div_ok = b != 0 && !(a == I64_MIN && b == -1);
+    CHECK(da.checked_div(b).has_value() == div_ok);
+    if (div_ok) {
+        CHECK(da.checked_div(b)->total_nanoseconds() == a / b);
+        CHECK(da / db == a / b);
+        CHECK((da % db).total_nanoseconds() == a % b);
+    } else {
+        CHECK_THROWS(da / b, std::overflow_error);
+        CHECK_THROWS(da / db, std::overflow_error);
+    }
+}
+
+void check_extremes() {
+    const Duration lo = Duration::min(), hi = Duration::max(), one(1);
+    CHECK(!hi.checked_add(one));
+    CHECK(!lo.checked_sub(one));
+    CHECK(!lo.checked_mul(-1));
+    CHECK(!lo.checked_div(-1));
+    CHECK(!one.checked_div(0));
+    CHECK(hi.saturating_add(hi) == hi);
+    CHECK(lo.saturating_add(lo) == lo);
+    CHECK(lo.saturating_sub(one) == lo);
+    CHECK(hi.saturating_sub(Duration(-1)) == hi);
+    CHECK(lo.saturating_sub(lo) == Duration());
+    CHECK(lo.saturating_mul(-1) == hi);
+    CHECK(hi.saturating_mul(-2) == lo);
+    CHECK(lo.saturating_mul(0) == Duration());
+    CHECK((lo % Duration(-1)) == Duration());
+    CHECK_THROWS(-lo, std::overflow_error);
+    CHECK_THROWS(lo.abs(), std::overflow_error);
+    CHECK(hi.abs() == hi);
+    CHECK(-hi == lo + one);
+    CHECK_THROWS(Duration::from_days(I64_MAX / 1000), std::overflow_error);
+    CHECK_THROWS(one / Duration(), std::overflow_error);
+    CHECK_THROWS(one % Duration(), std::overflow_error);
+
+    CHECK_THROWS(DateTime(9999, 1, 1) - DateTime(1, 1, 1), std::overflow_error);
+}
+
+// ============================================================================
+// ISO 8601
+// ============================================================================
+
+void check_round_trip(int64_t n) {
+    const Duration d(n);
+    const std::string text = d.to_iso8601();
+    CHECK(text.size() <= Duration::ISO8601_MAX_LENGTH);
+    auto back = Duration::parse_iso8601(text);
+    CHECK(back.has_value() && *back == d);
+}
+
+void check_iso_text() {
+    CHECK(Duration::from_minutes(90).to_iso8601() == "PT1H30M");
+    CHECK(Duration::from_milliseconds(250).to_iso8601() == "PT0.25S");
+    CHECK(Duration::from_hours(-36).to_iso8601() == "-PT36H");
+    CHECK(Duration().to_iso8601() == "PT0S");
+    CHECK(Duration(-1).to_iso8601() == "-PT0.000000001S");
+    CHECK(Duration::max().to_iso8601() == "PT2562047H47M16.854775807S");
+    CHECK(Duration::min().to_iso8601() == "-PT2562047H47M16.854775808S");
+
+    CHECK(Duration::parse_iso8601("P1W") == Duration::from_days(7));
+    CHECK(Duration::parse_iso8601("P2DT3H") == Duration::from_hours(51));
+    CHECK(Duration::parse_iso8601("+PT1M") == Duration::from_minutes(1));
+    CHECK(Duration::parse_iso8601("PT0,5S") == Duration::from_milliseconds(500));
+    CHECK(Duration::parse_iso8601("PT1.0000000019S") == Duration(1000000001));   // extra digits truncate
+    CHECK(Duration::parse_iso8601("-P1DT1S") == -Duration::from_seconds(86401));
+
+    const char* malformed[] = {
+        "", "P", "PT", "-P", "1H", "pT1H", "PT1h", "P1Y", "P1M", "PT1D", "P1H",
+        "P1DT", "PT1H1H", "PT1S1M", "P1D1W", "PTT1H", "PT-1H", "P-1D", "--PT1S",
+        "PT1.5H", "PT1.S", "PT.5S", "PT1.5", "PT1", "PT1H ", " PT1H", "PT1HX",
+        "PT9223372037S", "PT2562047H47M16.854775808S", "-PT2562047H47M16.854775809S",
+        "PT99999999999999999999S",
+    };
+    for (const char* s : malformed) {
+        if (Duration::parse_iso8601(s)) test::fail(__FILE__, __LINE__, s);
+        ++test::checks;
+    }
+
+    for (int64_t n : {I64_MIN, I64_MIN + 1, I64_MAX, I64_MAX - 1, int64_t{0}, int64_t{1}, int64_t{-1}}) {
+        check_round_trip(n);
+    }
+    for (int i = 0; i < 100000; ++i) check_round_trip(random_value());
+}
+
+// ============================================================================
+// DateTime / Duration
+// ============================================================================
+
+void check_datetime() {
+    const Duration lo = Duration::min(), hi = Duration::max();
+
+    // dt - min() is dt + 2^63 ns
+    for (DateTime dt : {DateTime(1900, 1, 1), DateTime(1970, 1, 1), DateTime(2024, 2, 29, 23, 59, 59, 999999999)}) {
+        DateTime shifted = dt - lo;
+        CHECK(shifted == (dt + hi) + Duration(1));
+        CHECK(shifted - hi == dt + Duration(1));
+        CHECK(!zuu::checked_difference(shifted, dt));
+        CHECK_THROWS(shifted - dt, std::overflow_error);
+        DateTime compound = dt;
+        compound -= lo;
+        CHECK(compound == shifted);
+        CHECK((dt + lo) + Duration(1) == dt - hi);
+    }
+
+    // A date step past 0001..9999 leaves the date alone; the time still moves
+    const DateTime late(9800, 6, 15, 12);
+    CHECK((late - lo).get_date() == late.get_date());
+    CHECK((DateTime(1, 1, 1) + lo).get_date() == zuu::Date(1, 1, 1));
+    CHECK(DateTime(9000, 1, 1) - lo == DateTime(9000, 1, 1) + hi + Duration(1));
+
+    // Differences up to the Duration range are exact
+    const DateTime epoch(1970, 1, 1);
+    CHECK(zuu::checked_difference(epoch + hi, epoch) == hi);
+    CHECK(zuu::checked_difference(epoch + lo, epoch) == lo);
+    CHECK(!zuu::checked_difference(epoch + hi + Duration(1), epoch));
+    CHECK(zuu::checked_difference(epoch, epoch + hi) == Duration(-I64_MAX));
+}
+
+} // namespace
+
+int main() {
+    check_extremes();
+    for (int i = 0; i < 200000; ++i) check_arithmetic(random_value(), random_value());
+    check_iso_text();
+    check_datetime();
+    return test::finish();
+}
@@ -0,0 +1,222 @@
+/**
+ * @file epoch_text.cpp
+ * @brief Epoch timestamp parsing and writing against 128-bit references
+ *
+ * The SWAR helpers (leading_digits8, parse8, read_digit_run) are compared
+ * with byte-at-a-time loops on random digit runs broken by every kind of
+ * non-digit byte. Unit detection is checked for every integer digit count
+ * from 1 to 19, with signs, leading zeros and fractions, and the parsed
+ * value against __int128 arithmetic. write_epoch must parse back exactly
+ * in every unit, from INT64_MIN to INT64_MAX.
+ */
+
+#include "test_check.hpp"
+#include "../epoch_text.hpp"
+#include <limits>
+#include <random>
+#include <string>
+
+namespace {
+
+using zuu::EpochUnit;
+using zuu::parse_epoch_nanos;
+using i128 = __int128;
+
+constexpr int64_t I64_MIN = std::numeric_limits<int64_t>::min();
+constexpr int64_t I64_MAX = std::numeric_limits<int64_t>::max();
+constexpr EpochUnit UNITS[] = {EpochUnit::Seconds, EpochUnit::Milliseconds, EpochUnit::Microseconds,
+                               EpochUnit::Nanoseconds};
+
+std::mt19937_64 rng(35);
+
+char random_digit() { return static_cast<char>('0' + rng() % 10); }
+
+/// Any byte that is not '0'..'9', weighted toward the ones next to the digits
+char random_non_digit() {
+    const char near[] = {'/', ':', '.', '-', ' ', '\0', static_cast<char>(0x80), static_cast<char>(0xFF),
+                         static_cast<char>(0xB0), static_cast<char>(0xB9)};
+    if (rng() % 2) return near[rng() % std::size(near)];
+    char c;
+    do c = static_cast<char>(rng()); while (c >= '0' && c <= '9');
+    return c;
+}
+
+i128 unit_scale(EpochUnit unit) { return zuu::detail::EPOCH_UNIT_SCALE[static_cast<size_t>(unit)]; }
+
+/// Reference parse of "[-]digits[.digits]" in a known unit (input known to be well formed)
+std::optional<int64_t> reference_parse(const std::string& s, EpochUnit unit) {
+    size_t i = s[0] == '-';
+    i128 whole = 0;
+    for (; i < s.size() && s[i] != '.'; ++i) whole = whole * 10 + (s[i] - '0');
+    i128 frac = 0, frac_scale = 1;
+    if (i < s.size()) {
+        for (size_t k = i + 1; k < s.size() && k <= i + 9; ++k) {
+            frac = frac * 10 + (s[k] - '0');
+            frac_scale *= 10;
+        }
+    }
+    i128 v = whole * unit_scale(unit) + frac * unit_scale(unit) / frac_scale;
+    if (s[0] == '-') v = -v;
+    if (v < I64_MIN || v > I64_MAX) return std::nullopt;
+    return static_cast<int64_t>(v);
+}
+
+// ============================================================================
+// SWAR helpers
+// ============================================================================
+
+void check_swar() {
+    for (int i = 0; i < 1000000; ++i) {
+        char buf[8];
+        int digits = static_cast<int>(rng() % 9);
+        for (int k = 0; k < 8; ++k) buf[k] = k < digits ? random_digit() : (rng() % 4 ? random_non_digit() : random_digit());
+        if (digits < 8) buf[digits] = random_non_digit();
+
+        const uint64_t v = zuu::detail::load8(buf);
+        CHECK(zuu::detail::leading_digits8(v) == digits);
+        if (digits == 8) {
+            uint32_t expected = 0;
+            for (char c : buf) expected = expected * 10 + static_cast<uint32_t>(c - '0');
+            CHECK(zuu::detail::parse8(v) == expected);
+        }
+    }
+    CHECK(zuu::detail::parse8(zuu::detail::load8("00000000")) == 0);
+    CHECK(zuu::detail::parse8(zuu::detail::load8("99999999")) == 99999999);
+    CHECK(zuu::detail::parse8(zuu::detail::load8("12345678")) == 12345678);
+
+    // Digit runs of any length with a keep limit, with and without a terminator
+    for (int i = 0; i < 200000; ++i) {
+        std::string s;
+        size_t run = rng() % 40;
+        for (size_t k = 0; k < run; ++k) s += random_digit();
+        if (rng() % 2) s += random_non_digit();
+        for (size_t k = rng() % 10; k > 0; --k) s += random_digit();
+        const size_t keep = rng() % 21;
+
+        const char* p = s.data();
+        uint64_t value = 0;
+        const size_t count = zuu::detail::read_digit_run(p, s.data() + s.size(), value, keep);
+
+        size_t expected_count = 0;
+        uint64_t expected_value = 0;
+        while (expected_count < s.size() && s[expected_count] >= '0' && s[expected_count] <= '9') {
+            if (expected_count < keep) expected_value = expected_value * 10 + static_cast<uint64_t>(s[expected_count] - '0');
+            ++expected_count;
+        }
+        CHECK(count == expected_count);
+        CHECK(p == s.data() + expected_count);
+        CHECK(value == expected_value);
+    }
+}
+
+// ============================================================================
+// Unit detection
+// ============================================================================
+
+void check_unit_detection() {
+    for (int i = 0; i < 500000; ++i) {
+        const size_t digits = 1 + rng() % 19;
+        std::string s = rng() % 2 ? "-" : "";
+        for (size_t k = 0; k < digits; ++k) s += random_digit();
+        if (rng() % 2) {
+            s += '.';
+            for (size_t k = 1 + rng() % 12; k > 0; --k) s += random_digit();
+        }
+
+        const EpochUnit unit = digits <= 10 ? EpochUnit::Seconds
+                             : digits <= 13 ? EpochUnit::Milliseconds
+                             : digits <= 16 ? EpochUnit::Microseconds
+                             : EpochUnit::Nanoseconds;
+        CHECK(parse_epoch_nanos(s) == parse_epoch_nanos(s, unit));
+        for (EpochUnit u : UNITS) CHECK(parse_epoch_nanos(s, u) == reference_parse(s, u));
+    }
+
+    // Boundaries of each digit count (the largest value of each count overflows int64)
+    CHECK(!parse_epoch_nanos("9999999999"));
+    CHECK(parse_epoch_nanos("10000000000") == int64_t{10000000000} * 1'000'000);
+    CHECK(!parse_epoch_nanos("9999999999999"));
+    CHECK(parse_epoch_nanos("10000000000000") == int64_t{10000000000000} * 1'000);
+    CHECK(!parse_epoch_nanos("9999999999999999"));
+    CHECK(parse_epoch_nanos("10000000000000000") == int64_t{10000000000000000});
+    CHECK(parse_epoch_nanos("1700000000") == int64_t{1700000000} * 1'000'000'000);
+    CHECK(parse_epoch_nanos("1700000000123") == int64_t{1700000000123} * 1'000'000);
+    CHECK(parse_epoch_nanos("1700000000123456") == int64_t{1700000000123456} * 1'000);
+    CHECK(parse_epoch_nanos("1700000000123456789") == int64_t{1700000000123456789});
+    CHECK(parse_epoch_nanos("1700000000.5") == int64_t{1700000000500000000});
+    CHECK(parse_epoch_nanos("-1.5") == int64_t{-1500000000});
+    CHECK(parse_epoch_nanos("0001700000000") == int64_t{1700000000} * 1'000'000);   // leading zeros count
+    CHECK(parse_epoch_nanos("1.1234567891") == int64_t{1123456789});                 // truncated to ns
+
+    // Range limits
+    CHECK(parse_epoch_nanos("9223372036854775807") == I64_MAX);
+    CHECK(parse_epoch_nanos("-9223372036854775808") == I64_MIN);
+    CHECK(!parse_epoch_nanos("9223372036854775808"));
+    CHECK(!parse_epoch_nanos("-9223372036854775809"));
+    CHECK(parse_epoch_nanos("9223372036.854775807") == I64_MAX);
+    CHECK(parse_epoch_nanos("-9223372036.854775808") == I64_MIN);
+    CHECK(!parse_epoch_nanos("9223372036.854775808"));
+    CHECK(!parse_epoch_nanos("-9223372036.854775809"));
+    CHECK(!parse_epoch_nanos("9223372037"));
+    CHECK(!parse_epoch_nanos("99999999999999999999"));
+
+    const char* bad[] = {"", "-", ".", "-.", ".5", "1.", "-1.", "+1", " 1", "1 ", "1.5x", "1..5", "1.-5",
+                         "--1", "1e9", "0x10"};
+    for (const char* s : bad) {
+        ++test::checks;
+        if (parse_epoch_nanos(s)) test::fail(__FILE__, __LINE__, s);
+    }
+}
+
+// ============================================================================
+// write_epoch round trip
+// ============================================================================
+
+void check_round_trip(int64_t ns) {
+    char buf[zuu::EPOCH_MAX_LENGTH];
+    for (EpochUnit unit : UNITS) {
+        const int max_decimals = 9 - 3 * static_cast<int>(unit);
+        const size_t len = zuu::write_epoch(ns, unit, max_decimals, buf);
+        const std::string s(buf, len);
+        CHECK(len <= zuu::EPOCH_MAX_LENGTH);
+        CHECK(parse_epoch_nanos(s, unit) == ns);
+        CHECK(zuu::to_epoch_string(ns, unit, max_decimals) == s);
+
+        // Fewer decimals truncate toward zero
+        const int decimals = static_cast<int>(rng() % static_cast<uint64_t>(max_decimals + 1));
+        const i128 step = unit_scale(unit) / zuu::detail::POW10[decimals];
+        const std::string cut(buf, zuu::write_epoch(ns, unit, decimals, buf));
+        CHECK(parse_epoch_nanos(cut, unit) == static_cast<int64_t>(i128{ns} / step * step));
+    }
+}
+
+void check_write() {
+    const int64_t edges[] = {I64_MIN, I64_MIN + 1, I64_MIN + 999'999'999, -1'000'000'000, -999'999'999, -1, 0,
+                             1, 999'999'999, 1'000'000'000, I64_MAX - 999'999'999, I64_MAX - 1, I64_MAX};
+    for (int64_t ns : edges) check_round_trip(ns);
+    for (int i = 0; i < 200000; ++i) check_round_trip(static_cast<int64_t>(rng()));
+
+    // At the limits every unit writes its full digit count, so detection agrees
+    char buf[zuu::EPOCH_MAX_LENGTH];
+    for (int64_t ns : {I64_MIN, I64_MAX}) {
+        for (EpochUnit unit : UNITS) {
+            const std::string s(buf, zuu::write_epoch(ns, unit, 9, buf));
+            CHECK(parse_epoch_nanos(s) == ns);
+        }
+    }
+
+    CHECK(zuu::to_epoch_string(I64_MIN, EpochUnit::Seconds, 9) == "-9223372036.854775808");
+    CHECK(zuu::to_epoch_string(I64_MAX, EpochUnit::Milliseconds, 9) == "9223372036854.775807");
+    CHECK(zuu::to_epoch_string(I64_MIN, EpochUnit::Nanoseconds, 3) == "-9223372036854775808");
+    CHECK(zuu::to_epoch_string(-1'500'000'000, EpochUnit::Seconds, 3) == "-1.500");
+    CHECK(zuu::to_epoch_string(-1, EpochUnit::Seconds, 0) == "-0");
+    CHECK(zuu::to_epoch_string(1'700'000'000'123'456'789, EpochUnit::Microseconds, -1) == "1700000000123456");
+}
+
+} // namespace
+
+int main() {
+    check_swar();
+    check_unit_detection();
+    check_write();
+    return test::finish();
+}
@@ -0,0 +1,166 @@
+/**
+ * @file http_date.cpp
+ * @brief RFC 7231 HTTP-date parsing in all three forms
+ *
+ * Random datetimes are written as IMF-fixdate, RFC 850 and asctime with
+ * snprintf and parsed back; write_http_date must round-trip. Malformed
+ * separators, names, fields and lengths must be rejected, and second 60
+ * is accepted only at 23:59:60.
+ */
+
+#include "test_check.hpp"
+#include "../http_date.hpp"
+#include <cctype>
+#include <cstdio>
+#include <random>
+#include <string>
+
+namespace {
+
+using zuu::DateTime;
+using zuu::parse_http_date;
+
+const char* const DAY_ABBREV[] = {"Mon", "Tue", "Wed", "Thu", "Fri", "Sat", "Sun"};
+const char* const DAY_NAME[] = {"Monday", "Tuesday", "Wednesday", "Thursday", "Friday", "Saturday", "Sunday"};
+const char* const MONTH[] = {"Jan", "Feb", "Mar", "Apr", "May", "Jun", "Jul", "Aug", "Sep", "Oct", "Nov", "Dec"};
+
+std::mt19937_64 rng(33);
+
+DateTime random_datetime(int min_year, int max_year) {
+    int y = min_year + static_cast<int>(rng() % static_cast<uint64_t>(max_year - min_year + 1));
+    int mo = 1 + static_cast<int>(rng() % 12);
+    int d = 1 + static_cast<int>(rng() % static_cast<uint64_t>(zuu::days_in_month(mo, y)));
+    return DateTime(y, mo, d, static_cast<int>(rng() % 24), static_cast<int>(rng() % 60), static_cast<int>(rng() % 60));
+}
+
+std::string imf_fixdate(const DateTime& dt) {
+    char buf[64];
+    std::snprintf(buf, sizeof buf, "%s, %02d %s %04d %02d:%02d:%02d GMT", DAY_ABBREV[dt.day_of_week()], dt.day(),
+                  MONTH[dt.month() - 1], dt.year(), dt.hour(), dt.minute(), dt.second());
+    return buf;
+}
+
+std::string rfc850(const DateTime& dt) {
+    char buf[64];
+    std::snprintf(buf, sizeof buf, "%s, %02d-%s-%02d %02d:%02d:%02d GMT", DAY_NAME[dt.day_of_week()], dt.day(),
+                  MONTH[dt.month() - 1], dt.year() % 100, dt.hour(), dt.minute(), dt.second());
+    return buf;
+}
+
+std::string asctime(const DateTime& dt) {
+    char buf[64];
+    std::snprintf(buf, sizeof buf, "%s %s %2d %02d:%02d:%02d %04d", DAY_ABBREV[dt.day_of_week()],
+                  MONTH[dt.month() - 1], dt.day(), dt.hour(), dt.minute(), dt.second(), dt.year());
+    return buf;
+}
+
+void check_forms() {
+    for (int i = 0; i < 100000; ++i) {
+        const DateTime dt = random_datetime(1, 9999);
+        CHECK(parse_http_date(imf_fixdate(dt)) == dt);
+        CHECK(parse_http_date(asctime(dt)) == dt);
+        CHECK(zuu::to_http_date(dt) == imf_fixdate(dt));
+        CHECK(parse_http_date(zuu::to_http_date(dt)) == dt);
+
+        // RFC 850 two-digit years pivot at 69
+        const DateTime recent = random_datetime(1969, 2068);
+        CHECK(parse_http_date(rfc850(recent)) == recent);
+    }
+
+    // The RFC 7231 examples
+    const DateTime example(1994, 11, 6, 8, 49, 37);
+    CHECK(parse_http_date("Sun, 06 Nov 1994 08:49:37 GMT") == example);
+    CHECK(parse_http_date("Sunday, 06-Nov-94 08:49:37 GMT") == example);
+    CHECK(parse_http_date("Sun Nov  6 08:49:37 1994") == example);
+    CHECK(parse_http_date("Sun Nov 06 08:49:37 1994") == example);   // zero-padded day
+    CHECK(parse_http_date("Thursday, 01-Jan-70 00:00:00 GMT") == DateTime(1970, 1, 1));
+    CHECK(parse_http_date("Friday, 31-Dec-68 23:59:59 GMT") == DateTime(2068, 12, 31, 23, 59, 59));
+
+    // The day name must be a valid name but need not match the date
+    CHECK(parse_http_date("Mon, 06 Nov 1994 08:49:37 GMT") == example);
+
+    // Sub-second parts are dropped when writing
+    CHECK(zuu::to_http_date(DateTime(1994, 11, 6, 8, 49, 37, 999999999)) == "Sun, 06 Nov 1994 08:49:37 GMT");
+}
+
+void check_leap_second() {
+    CHECK(parse_http_date("Sat, 31 Dec 2016 23:59:60 GMT") == DateTime(2016, 12, 31, 23, 59, 59));
+    CHECK(parse_http_date("Saturday, 31-Dec-16 23:59:60 GMT") == DateTime(2016, 12, 31, 23, 59, 59));
+    CHECK(parse_http_date("Sat Dec 31 23:59:60 2016") == DateTime(2016, 12, 31, 23, 59, 59));
+    CHECK(!parse_http_date("Sat, 31 Dec 2016 12:00:60 GMT"));
+    CHECK(!parse_http_date("Sat, 31 Dec 2016 23:58:60 GMT"));
+    CHECK(!parse_http_date("Sat, 31 Dec 2016 22:59:60 GMT"));
+    CHECK(!parse_http_date("Sat Dec 31 00:59:60 2016"));
+    CHECK(!parse_http_date("Sat, 31 Dec 2016 23:59:61 GMT"));
+}
+
+void check_malformed() {
+    const char* bad[] = {
+        "",
+        "Sun, 06 Nov 1994 08:49:37 GMT ",       // trailing space
+        " Sun, 06 Nov 1994 08:49:37 GMT",       // leading space
+        "Sun, 06 Nov 1994 08:49:37 UTC",        // zone must be GMT
+        "Sun, 06 Nov 1994 08:49:37 gmt",
+        "Sun, 06-Nov-1994 08:49:37 GMT",        // separators
+        "Sun,  6 Nov 1994 08:49:37 GMT",
+        "Sun, 06 Nov 1994 08.49.37 GMT",
+        "Sun, 06 Nov 1994 08:49-37 GMT",
+        "Sun; 06 Nov 1994 08:49:37 GMT",
+        "Sun, 06 nov 1994 08:49:37 GMT",        // names are case-sensitive
+        "sun, 06 Nov 1994 08:49:37 GMT",
+        "Sux, 06 Nov 1994 08:49:37 GMT",
+        "Sun, 06 Nox 1994 08:49:37 GMT",
+        "Sun, 31 Nov 1994 08:49:37 GMT",        // fields out of range
+        "Sun, 00 Nov 1994 08:49:37 GMT",
+        "Sun, 29 Feb 1900 08:49:37 GMT",
+        "Sun, 06 Nov 0000 08:49:37 GMT",
+        "Sun, 06 Nov 1994 24:00:00 GMT",
+        "Sun, 06 Nov 1994 08:60:00 GMT",
+        "Sun, 06 Nov 19x4 08:49:37 GMT",
+        "Sun, 06 Nov 1994 8:49:37 GMT",
+        "Sun, 06 Nov 1994 08:49:37",
+        "Sun, 06 Nov 1994 08:49:37 GMTX",
+        "Sunday, 06-Nov-94 08:49:37 UTC",       // RFC 850
+        "Sun, 06-Nov-94 08:49:37 GMT",
+        "Sundae, 06-Nov-94 08:49:37 GMT",
+        "Monday, 06-Nov-94 08:49:37 GMTT",
+        "Sunday, 06 Nov 94 08:49:37 GMT",
+        "Sunday, 06-Nov-9x 08:49:37 GMT",
+        "Sunday,06-Nov-94 08:49:37 GMT",
+        "Sunday, 30-Feb-94 08:49:37 GMT",
+        "Sun Nov  6 08:49:37 1994 ",            // asctime
+        "Sun Nov 6 08:49:37 1994",
+        "Sun Nov  6 08:49:37  1994",
+        "Sun  Nov 6 08:49:37 1994",
+        "Sun Nov  6 08:49:37 94",
+        "Sun Nov 31 08:49:37 1994",
+        "Sun Nov  x 08:49:37 1994",
+        "Sun,Nov  6 08:49:37 1994",
+    };
+    for (const char* s : bad) {
+        ++test::checks;
+        if (parse_http_date(s)) test::fail(__FILE__, __LINE__, s);
+    }
+
+    // Replacing any character with a non-digit makes the date invalid
+    const std::string good = "Sun, 06 Nov 1994 08:49:37 GMT";
+    for (size_t i = 0; i < good.size(); ++i) {
+        for (char c : {' ', ',', ':', '-', 'x', '0', '\0'}) {
+            std::string s = good;
+            if (s[i] == c) continue;
+            s[i] = c;
+            auto r = parse_http_date(s);
+            ++test::checks;
+            if (r && !std::isdigit(static_cast<unsigned char>(c))) test::fail(__FILE__, __LINE__, s.c_str());
+        }
+    }
+}
+
+} // namespace
+
+int main() {
+    check_forms();
+    check_leap_second();
+    check_malformed();
+    return test::finish();
+}
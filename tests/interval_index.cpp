@@ -0,0 +1,155 @@
+/**
+ * @file interval_index.cpp
+ * @brief IntervalIndex stabbing and overlap queries against linear search
+ *
+ * Random entries (including empty intervals, duplicate starts and keys at
+ * the int64 extremes) are bulk-loaded at sizes that exercise every tree
+ * depth, including the small-subtree scan and a partially filled last
+ * level. Every stabbing(), overlapping() and count_overlaps() result is
+ * compared with a scan over the input, as sorted payload lists; empty
+ * entries must match nothing, as with Interval::overlaps.
+ */
+
+#include "test_check.hpp"
+#include "../interval_index.hpp"
+#include <algorithm>
+#include <limits>
+#include <random>
+#include <vector>
+
+namespace {
+
+using Index = zuu::IntervalIndex<int, int64_t>;
+using Iv = zuu::Interval<int64_t>;
+
+constexpr int64_t KEY_MIN = std::numeric_limits<int64_t>::min();
+constexpr int64_t KEY_MAX = std::numeric_limits<int64_t>::max();
+
+std::mt19937_64 rng(27);
+
+/// Key from a small domain (many collisions), or occasionally an extreme
+int64_t random_key(int64_t span) {
+    switch (rng() % 16) {
+        case 0: return KEY_MIN;
+        case 1: return KEY_MAX;
+        case 2: return KEY_MIN + static_cast<int64_t>(rng() % 4);
+        case 3: return KEY_MAX - static_cast<int64_t>(rng() % 4);
+        default: return static_cast<int64_t>(rng() % static_cast<uint64_t>(2 * span)) - span;
+    }
+}
+
+Iv random_interval(int64_t span) {
+    int64_t a = random_key(span);
+    int64_t b = random_key(span);
+    if (rng() % 8 == 0) b = a;   // empty
+    return Iv(std::min(a, b), std::max(a, b));
+}
+
+std::vector<int> sorted(std::vector<int> v) {
+    std::sort(v.begin(), v.end());
+    return v;
+}
+
+std::vector<int> brute_overlap(const std::vector<Index::Entry>& entries, const Iv& q) {
+    std::vector<int> out;
+    for (const auto& e : entries) {
+        if (Iv(e.start, e.end).overlaps(q)) out.push_back(e.payload);
+    }
+    return sorted(out);
+}
+
+std::vector<int> brute_stab(const std::vector<Index::Entry>& entries, int64_t k) {
+    std::vector<int> out;
+    for (const auto& e : entries) {
+        if (e.start <= k && k < e.end) out.push_back(e.payload);
+    }
+    return sorted(out);
+}
+
+void check_against_brute_force(size_t n, int64_t span, int queries) {
+    std::vector<Index::Entry> entries(n);
+    for (size_t i = 0; i < n; ++i) {
+        Iv iv = random_interval(span);
+        entries[i] = {iv.start(), iv.end(), static_cast<int>(i)};
+    }
+    const Index idx = Index::build(std::span<const Index::Entry>(entries));
+    CHECK(idx.size() == n);
+    CHECK(idx.empty() == (n == 0));
+
+    // Entries come back in start order with their own payloads
+    for (size_t i = 0; i < idx.size(); ++i) {
+        const auto& e = entries[static_cast<size_t>(idx.payload(i))];
+        CHECK(idx.interval(i) == Iv(e.start, e.end));
+        if (i > 0) CHECK(idx.interval(i - 1).start() <= idx.interval(i).start());
+    }
+
+    for (int q = 0; q < queries; ++q) {
+        int64_t k = random_key(span);
+        CHECK(sorted(idx.stabbing(k)) == brute_stab(entries, k));
+
+        Iv range = random_interval(span);
+        std::vector<int> expected = brute_overlap(entries, range);
+        CHECK(sorted(idx.overlapping(range)) == expected);
+        CHECK(idx.count_overlaps(range) == expected.size());
+    }
+
+    // Every entry boundary, where off-by-one errors would show
+    for (const auto& e : entries) {
+        CHECK(sorted(idx.stabbing(e.start)) == brute_stab(entries, e.start));
+        CHECK(sorted(idx.stabbing(e.end)) == brute_stab(entries, e.end));
+    }
+}
+
+void check_edges() {
+    const Index empty;
+    CHECK(empty.stabbing(0).empty());
+    CHECK(empty.count_overlaps(Iv(KEY_MIN, KEY_MAX)) == 0);
+
+    // The largest key is in no half-open interval; the smallest can be
+    std::vector<Index::Entry> entries = {
+        {KEY_MIN, KEY_MAX, 0}, {KEY_MAX, KEY_MAX, 1}, {KEY_MIN, KEY_MIN + 1, 2}, {5, 5, 3},
+    };
+    const Index idx = Index::build(std::span<const Index::Entry>(entries));
+    CHECK(idx.stabbing(KEY_MAX).empty());
+    CHECK(sorted(idx.stabbing(KEY_MIN)) == (std::vector<int>{0, 2}));
+    CHECK(idx.stabbing(5) == (std::vector<int>{0}));
+    CHECK(idx.count_overlaps(Iv(KEY_MIN, KEY_MAX)) == 2);
+    CHECK(idx.count_overlaps(Iv(KEY_MAX - 1, KEY_MAX)) == 1);
+    CHECK(idx.count_overlaps(Iv(3, 3)) == 0);
+    CHECK(idx.count_overlaps(Iv(0, 10)) == 1);   // the empty [5, 5) does not match
+
+    // Raw-key build uses the shortest of the three spans
+    std::vector<int64_t> s = {0, 1, 2}, e = {10, 11};
+    std::vector<int> p = {7, 8, 9};
+    const Index raw = Index::build(s, e, p);
+    CHECK(raw.size() == 2);
+    CHECK(sorted(raw.stabbing(5)) == (std::vector<int>{7, 8}));
+}
+
+void check_datetime_keys() {
+    using zuu::DateTime;
+    std::vector<zuu::IntervalIndex<int>::Entry> entries = {
+        {DateTime(2024, 1, 1), DateTime(2024, 1, 2), 1},
+        {DateTime(2024, 1, 1, 12), DateTime(2024, 1, 3), 2},
+    };
+    const auto idx = zuu::IntervalIndex<int>::build(std::span<const zuu::IntervalIndex<int>::Entry>(entries));
+    CHECK(sorted(idx.stabbing(DateTime(2024, 1, 1, 18))) == (std::vector<int>{1, 2}));
+    CHECK(idx.stabbing(DateTime(2024, 1, 2)) == (std::vector<int>{2}));
+    CHECK(idx.stabbing(DateTime(2024, 1, 3)).empty());
+    CHECK(idx.count_overlaps({DateTime(2023, 12, 31), DateTime(2024, 1, 1)}) == 0);
+}
+
+} // namespace
+
+int main() {
+    check_edges();
+    check_datetime_keys();
+    for (size_t n : {0, 1, 2, 3, 7, 8, 15, 16, 17, 31, 33, 100, 255, 256, 257, 1000}) {
+        for (int round = 0; round < 20; ++round) {
+            check_against_brute_force(n, 8, 50);
+            check_against_brute_force(n, 1000, 50);
+        }
+    }
+    check_against_brute_force(5000, 100000, 500);
+    return test::finish();
+}
@@ -0,0 +1,187 @@
+/**
+ * @file interval_set.cpp
+ * @brief IntervalSet algebra and queries against a brute-force bitset
+ *
+ * Random intervals over a 64-point domain (including empty, adjacent and
+ * nested ones) are inserted one by one and built in bulk; every result of
+ * unite/intersect/subtract and every contains/overlaps query is compared
+ * with the same operation on a 64-bit mask, and the sets are checked to be
+ * normalised (sorted, non-empty, neither overlapping nor adjacent).
+ */
+
+#include "test_check.hpp"
+#include "../interval_core.hpp"
+#include <bit>
+#include <random>
+#include <vector>
+
+namespace {
+
+using Set = zuu::IntervalSet<int64_t>;
+using Iv = zuu::Interval<int64_t>;
+
+constexpr int64_t BASE = -32;   ///< Domain is [BASE, BASE + 64), straddling zero
+
+std::mt19937_64 rng(26);
+
+uint64_t mask_of(int64_t s, int64_t e) {
+    uint64_t m = 0;
+    for (int64_t k = s; k < e; ++k) m |= uint64_t{1} << (k - BASE);
+    return m;
+}
+
+uint64_t mask_of(const Set& set) {
+    uint64_t m = 0;
+    for (size_t i = 0; i < set.size(); ++i) m |= mask_of(set[i].start(), set[i].end());
+    return m;
+}
+
+bool normalised(const Set& set) {
+    auto s = set.start_keys();
+    auto e = set.end_keys();
+    for (size_t i = 0; i < set.size(); ++i) {
+        if (!(s[i] < e[i])) return false;
+        if (i > 0 && !(e[i - 1] < s[i])) return false;
+    }
+    return true;
+}
+
+Iv random_interval() {
+    int64_t a = BASE + static_cast<int64_t>(rng() % 65);
+    int64_t b = BASE + static_cast<int64_t>(rng() % 65);
+    if (rng() % 8 == 0) b = a;   // empty
+    return Iv(std::min(a, b), std::max(a, b));
+}
+
+/// Random set plus its mask; both insert() and build() must give the same set
+Set random_set(uint64_t& mask) {
+    std::vector<Iv> items(rng() % 8);
+    for (auto& iv : items) iv = random_interval();
+    Set inserted;
+    mask = 0;
+    for (const auto& iv : items) {
+        inserted.insert(iv);
+        mask |= mask_of(iv.start(), iv.end());
+    }
+    const Set built = Set::build(std::span<const Iv>(items));
+    CHECK(built == inserted);
+    CHECK(normalised(inserted));
+    CHECK(mask_of(inserted) == mask);
+    CHECK(inserted.measure() == std::popcount(mask));
+    return inserted;
+}
+
+void check_queries(const Set& set, uint64_t mask) {
+    for (int64_t k = BASE - 1; k <= BASE + 64; ++k) {
+        bool in = k >= BASE && k < BASE + 64 && ((mask >> (k - BASE)) & 1);
+        CHECK(set.contains(k) == in);
+    }
+    for (int q = 0; q < 16; ++q) {
+        Iv iv = random_interval();
+        uint64_t m = mask_of(iv.start(), iv.end());
+        CHECK(set.contains(iv) == ((m & ~mask) == 0));
+        CHECK(set.overlaps(iv) == ((m & mask) != 0));
+    }
+}
+
+void check_algebra(const Set& a, uint64_t ma, const Set& b, uint64_t mb) {
+    const Set u = a | b, i = a & b, d = a - b;
+    CHECK(normalised(u));
+    CHECK(normalised(i));
+    CHECK(normalised(d));
+    CHECK(mask_of(u) == (ma | mb));
+    CHECK(mask_of(i) == (ma & mb));
+    CHECK(mask_of(d) == (ma & ~mb));
+    CHECK(a.unite(b) == b.unite(a));
+    CHECK(a.intersect(b) == b.intersect(a));
+    CHECK((d | i) == a);
+
+    Set c = a;
+    c |= b;
+    CHECK(c == u);
+    c = a;
+    c &= b;
+    CHECK(c == i);
+    c = a;
+    c -= b;
+    CHECK(c == d);
+}
+
+void check_edges() {
+    // Adjacent intervals coalesce, in either insertion order
+    Set s;
+    s.insert(Iv(0, 5)).insert(Iv(5, 10));
+    CHECK(s.size() == 1 && s[0] == Iv(0, 10));
+    s.clear();
+    s.insert(Iv(5, 10)).insert(Iv(0, 5));
+    CHECK(s.size() == 1 && s[0] == Iv(0, 10));
+
+    // A gap of one point does not
+    s.clear();
+    s.insert(Iv(0, 5)).insert(Iv(6, 10));
+    CHECK(s.size() == 2);
+    CHECK(!s.contains(int64_t{5}));
+    CHECK(!s.contains(Iv(4, 7)));
+    CHECK(s.overlaps(Iv(4, 7)));
+    CHECK(!s.overlaps(Iv(5, 6)));
+
+    // Nested intervals, and an interval bridging two others
+    s.insert(Iv(2, 3));
+    CHECK(s.size() == 2);
+    s.insert(Iv(3, 8));
+    CHECK(s.size() == 1 && s[0] == Iv(0, 10));
+
+    // Empty intervals and empty sets
+    const Set empty;
+    s.insert(Iv(20, 20));
+    CHECK(s.size() == 1);
+    CHECK(s.contains(Iv(50, 50)));
+    CHECK(!s.overlaps(Iv(5, 5)));
+    CHECK((s | empty) == s);
+    CHECK((s & empty) == empty);
+    CHECK((s - empty) == s);
+    CHECK((empty - s) == empty);
+    CHECK((s - s) == empty);
+    CHECK(empty.measure() == 0);
+    CHECK(Set::build(std::span<const Iv>{}).empty());
+
+    // Subtracting a nested interval splits; subtracting the exact bounds removes
+    CHECK((s - Set().insert(Iv(4, 6))).size() == 2);
+    CHECK((s - Set().insert(Iv(0, 10))).empty());
+
+    CHECK_THROWS(Iv(5, 4), std::out_of_range);
+}
+
+void check_datetime_keys() {
+    // Same algebra through the DateTime and Date key mappings
+    using zuu::DateTime;
+    zuu::IntervalSet<DateTime> a;
+    a.insert({DateTime(2024, 1, 1), DateTime(2024, 1, 2)});
+    a.insert({DateTime(2024, 1, 2), DateTime(2024, 1, 3)});
+    CHECK(a.size() == 1);
+    CHECK(a.contains(DateTime(2024, 1, 2, 23, 59, 59)));
+    CHECK(!a.contains(DateTime(2024, 1, 3)));
+    CHECK(a.measure() == 2 * int64_t{zuu::detail::NANOS_PER_DAY});
+
+    using zuu::Date;
+    zuu::IntervalSet<Date> d;
+    d.insert({Date(2024, 2, 28), Date(2024, 3, 1)});
+    CHECK(d.measure() == 2);
+    CHECK(d.contains(Date(2024, 2, 29)));
+    CHECK(!d.contains(Date(2024, 3, 1)));
+}
+
+} // namespace
+
+int main() {
+    check_edges();
+    check_datetime_keys();
+    for (int round = 0; round < 20000; ++round) {
+        uint64_t ma = 0, mb = 0;
+        const Set a = random_set(ma);
+        const Set b = random_set(mb);
+        check_queries(a, ma);
+        check_algebra(a, ma, b, mb);
+    }
+    return test::finish();
+}
@@ -0,0 +1,106 @@
+/**
+ * @file leap_seconds.cpp
+ * @brief UTC / TAI conversions across positive and negative leap seconds
+ *
+ * Loads a user table that adds a negative leap second (TAI - UTC 37 -> 36
+ * at 2030-01-01) followed by a positive one (36 -> 37 at 2031-01-01), and
+ * walks TAI in half-second steps across every boundary of that table and
+ * the built-in one. Each value is converted with a converter that keeps its
+ * cached segment across the walk, with a fresh converter, and with the
+ * batch API, and checked against the expected UTC.
+ *
+ * Exits non-zero and prints the first mismatches if anything disagrees.
+ */
+
+#include "../leap_seconds.hpp"
+#include <cstdio>
+#include <string>
+#include <vector>
+
+namespace {
+
+constexpr int64_t NS = zuu::detail::NANOS_PER_SECOND_I64;
+constexpr int MAX_REPORTS = 20;
+
+int failures = 0;
+int checks = 0;
+
+void report(int64_t tai, const char* what) {
+    if (failures++ >= MAX_REPORTS) return;
+    std::fprintf(stderr, "FAIL TAI %lld ns: %s\n", static_cast<long long>(tai), what);
+}
+
+#define LEAP_CHECK(cond)                     \
+    do {                                     \
+        ++checks;                            \
+        if (!(cond)) report(tai, #cond);     \
+    } while (0)
+
+int64_t unix_seconds(int y, int m, int d) {
+    return int64_t{zuu::days_from_civil(y, m, d)} * zuu::detail::SECONDS_PER_DAY;
+}
+
+std::string ntp_line(int y, int m, int d, int offset) {
+    return std::to_string(unix_seconds(y, m, d) + zuu::detail::NTP_UNIX_OFFSET) + " " + std::to_string(offset) + "\n";
+}
+
+/// Expected UTC for a TAI instant, straight from the table entries
+zuu::LeapDateTime expected_utc(const zuu::LeapSecondTable& table, int64_t tai) {
+    const auto& e = table.entries();
+    int64_t secs = zuu::detail::floor_div(tai, NS);
+    size_t i = 0;
+    while (i + 1 < e.size() && e[i + 1].tai <= secs) ++i;
+    int64_t off = e[i].tai_minus_utc;
+    // Inside an inserted leap second: UTC has reached the next entry but TAI has not
+    if (i + 1 < e.size() && secs - off >= e[i + 1].utc) {
+        return zuu::LeapDateTime{zuu::DateTime::from_unix_nanos((e[i + 1].utc - 1) * NS + (tai - secs * NS)), true};
+    }
+    return zuu::LeapDateTime{zuu::DateTime::from_unix_nanos(tai - off * NS), false};
+}
+
+void check_table(const zuu::LeapSecondTable& table) {
+    std::vector<int64_t> walk;
+    for (const auto& entry : table.entries()) {
+        for (int64_t half = -8; half < 8; ++half) walk.push_back(entry.tai * NS + half * NS / 2);
+    }
+
+    std::vector<int64_t> batch(walk.size());
+    zuu::tai_to_unix_nanos(walk, batch, table);
+
+    zuu::TimeScaleConverter cached(table);
+    for (size_t k = 0; k < walk.size(); ++k) {
+        const int64_t tai = walk[k];
+        const zuu::LeapDateTime want = expected_utc(table, tai);
+        const zuu::LeapDateTime got = cached.tai_to_utc(tai);
+        LEAP_CHECK(got == want);
+        LEAP_CHECK(zuu::TimeScaleConverter(table).tai_to_utc(tai) == want);
+        LEAP_CHECK(batch[k] == want.datetime.to_unix_nanos());
+        LEAP_CHECK(cached.utc_to_tai(got) == tai);
+    }
+}
+
+} // namespace
+
+int main() {
+    const std::string text = "#@ " + std::to_string(unix_seconds(2035, 1, 1) + zuu::detail::NTP_UNIX_OFFSET) + "\n" +
+                             ntp_line(2017, 1, 1, 37) + ntp_line(2030, 1, 1, 36) + ntp_line(2031, 1, 1, 37);
+    auto user = zuu::LeapSecondTable::parse(text);
+    if (!user) {
+        std::fprintf(stderr, "FAIL: user table did not parse\n");
+        return 1;
+    }
+
+    check_table(zuu::LeapSecondTable::builtin());
+    check_table(*user);
+
+    // 2029-12-31 loses 23:59:59: TAI runs 23:59:58 (offset 37) straight into 00:00:00 (offset 36)
+    int64_t tai = (unix_seconds(2030, 1, 1) + 36) * NS;
+    zuu::TimeScaleConverter conv(*user);
+    LEAP_CHECK(conv.tai_to_utc(tai - NS).datetime == zuu::DateTime(2029, 12, 31, 23, 59, 58));
+    LEAP_CHECK(conv.tai_to_utc(tai) == zuu::LeapDateTime::make(2030, 1, 1, 0, 0, 0));
+    LEAP_CHECK(!user->has_leap_second(zuu::Date(2029, 12, 31)));
+    LEAP_CHECK(user->has_leap_second(zuu::Date(2030, 12, 31)));
+
+    std::printf("%d checks, %d failures\n", checks, failures);
+    return failures == 0 ? 0 : 1;
+}
@@ -0,0 +1,248 @@
+/**
+ * @file log_timestamp.cpp
+ * @brief Common Log Format, RFC 3164 and RFC 5424 (RFC 3339) timestamp parsing
+ *
+ * Random timestamps are written with snprintf and parsed back, with every
+ * UTC offset form and, for RFC 5424, fraction lengths 1 to 9. Malformed
+ * separators, offsets and fractions must be rejected, and second 60 is
+ * accepted only at 23:59 UTC once the offset is removed.
+ */
+
+#include "test_check.hpp"
+#include "../log_timestamp.hpp"
+#include <cstdio>
+#include <random>
+#include <string>
+
+namespace {
+
+using zuu::DateTime;
+using zuu::OffsetDateTime;
+
+const char* const MONTH[] = {"Jan", "Feb", "Mar", "Apr", "May", "Jun", "Jul", "Aug", "Sep", "Oct", "Nov", "Dec"};
+
+std::mt19937_64 rng(34);
+
+DateTime random_datetime(int nanos_digits = 0) {
+    int y = 1 + static_cast<int>(rng() % 9999);
+    int mo = 1 + static_cast<int>(rng() % 12);
+    int d = 1 + static_cast<int>(rng() % static_cast<uint64_t>(zuu::days_in_month(mo, y)));
+    int ns = 0;
+    if (nanos_digits > 0) {
+        int scale = 1;
+        for (int i = nanos_digits; i < 9; ++i) scale *= 10;
+        ns = static_cast<int>(rng() % static_cast<uint64_t>(1000000000 / scale)) * scale;
+    }
+    return DateTime(y, mo, d, static_cast<int>(rng() % 24), static_cast<int>(rng() % 60),
+                    static_cast<int>(rng() % 60), ns);
+}
+
+int32_t random_offset() {
+    if (rng() % 4 == 0) return 0;
+    return static_cast<int32_t>(rng() % (2 * 1439 + 1)) - 1439;
+}
+
+/// "+hhmm", or "+hh:mm" with colon
+std::string offset_text(int32_t minutes, bool colon) {
+    char buf[8];
+    int32_t mag = minutes < 0 ? -minutes : minutes;
+    std::snprintf(buf, sizeof buf, colon ? "%c%02d:%02d" : "%c%02d%02d", minutes < 0 ? '-' : '+', mag / 60, mag % 60);
+    return buf;
+}
+
+// ============================================================================
+// Common Log Format
+// ============================================================================
+
+std::string clf(const DateTime& dt, int32_t offset) {
+    char buf[32];
+    std::snprintf(buf, sizeof buf, "%02d/%s/%04d:%02d:%02d:%02d ", dt.day(), MONTH[dt.month() - 1], dt.year(),
+                  dt.hour(), dt.minute(), dt.second());
+    return buf + offset_text(offset, false);
+}
+
+void check_clf() {
+    for (int i = 0; i < 50000; ++i) {
+        const DateTime dt = random_datetime();
+        const int32_t offset = random_offset();
+        const std::string s = clf(dt, offset);
+        CHECK(zuu::parse_clf_timestamp(s) == (OffsetDateTime{dt, offset}));
+        CHECK(zuu::parse_clf_timestamp("[" + s + "]") == (OffsetDateTime{dt, offset}));
+    }
+
+    auto r = zuu::parse_clf_timestamp("[10/Oct/2000:13:55:36 -0700]");
+    CHECK(r == (OffsetDateTime{DateTime(2000, 10, 10, 13, 55, 36), -420}));
+    CHECK(r && r->to_utc() == DateTime(2000, 10, 10, 20, 55, 36));
+    CHECK(zuu::parse_clf_timestamp("01/Jan/2000:00:30:00 +0100")->to_utc() == DateTime(1999, 12, 31, 23, 30, 0));
+
+    // Leap second: 23:59 UTC after removing the offset
+    CHECK(zuu::parse_clf_timestamp("31/Dec/2016:23:59:60 +0000") ==
+          (OffsetDateTime{DateTime(2016, 12, 31, 23, 59, 59), 0}));
+    CHECK(zuu::parse_clf_timestamp("31/Dec/2016:15:59:60 -0800") ==
+          (OffsetDateTime{DateTime(2016, 12, 31, 15, 59, 59), -480}));
+    CHECK(zuu::parse_clf_timestamp("01/Jan/2017:05:44:60 +0545"));
+    CHECK(!zuu::parse_clf_timestamp("31/Dec/2016:23:59:60 -0800"));
+    CHECK(!zuu::parse_clf_timestamp("31/Dec/2016:12:00:60 +0000"));
+
+    const char* bad[] = {
+        "10/Oct/2000:13:55:36",                 // no offset
+        "10/Oct/2000:13:55:36 0700",
+        "10/Oct/2000:13:55:36 +07:00",
+        "10/Oct/2000:13:55:36 +2400",           // |offset| >= 24h
+        "10/Oct/2000:13:55:36 +0760",
+        "10/Oct/2000:13:55:36 *0700",
+        "10-Oct-2000:13:55:36 -0700",           // separators
+        "10/Oct/2000 13:55:36 -0700",
+        "10/Oct/2000:13.55.36 -0700",
+        "10/Oct/2000:13:55:36_-0700",
+        "[10/Oct/2000:13:55:36 -0700",
+        "10/Oct/2000:13:55:36 -0700]",
+        "(10/Oct/2000:13:55:36 -0700)",
+        "10/oct/2000:13:55:36 -0700",           // fields
+        "31/Sep/2000:13:55:36 -0700",
+        "10/Oct/2000:24:00:00 -0700",
+        "10/Oct/2000:13:60:00 -0700",
+        "10/Oct/2000:13:55:61 -0700",
+        "1/Oct/2000:13:55:36 -0700",
+        "10/Oct/200:13:55:36 -0700",
+        " 10/Oct/2000:13:55:36 -0700",
+    };
+    for (const char* s : bad) {
+        ++test::checks;
+        if (zuu::parse_clf_timestamp(s)) test::fail(__FILE__, __LINE__, s);
+    }
+}
+
+// ============================================================================
+// RFC 3164
+// ============================================================================
+
+void check_rfc3164() {
+    for (int i = 0; i < 50000; ++i) {
+        const DateTime reference = random_datetime();
+        const DateTime dt = random_datetime();
+        // The year keeps the month within six months of the reference's
+        int year = reference.year();
+        if (dt.month() - reference.month() > 6) --year;
+        if (dt.month() - reference.month() < -6) ++year;
+        char buf[32];
+        std::snprintf(buf, sizeof buf, rng() % 2 ? "%s %2d %02d:%02d:%02d" : "%s %02d %02d:%02d:%02d",
+                      MONTH[dt.month() - 1], dt.day(), dt.hour(), dt.minute(), dt.second());
+        if (!zuu::is_valid_date(year, dt.month(), dt.day())) {
+            // Feb 29 in a common year, or a year outside 0001..9999
+            CHECK(!zuu::parse_rfc3164_timestamp(buf, reference));
+            continue;
+        }
+        const DateTime expected(year, dt.month(), dt.day(), dt.hour(), dt.minute(), dt.second());
+        CHECK(zuu::parse_rfc3164_timestamp(buf, reference) == (OffsetDateTime{expected, 0}));
+    }
+
+    const DateTime reference(2024, 6, 15, 12);
+    CHECK(zuu::parse_rfc3164_timestamp("Oct 11 22:14:15", reference)->local == DateTime(2024, 10, 11, 22, 14, 15));
+    CHECK(zuu::parse_rfc3164_timestamp("Dec 31 23:59:59", DateTime(2025, 1, 1))->local.year() == 2024);
+    CHECK(zuu::parse_rfc3164_timestamp("Jan  1 00:00:00", DateTime(2024, 12, 31))->local.year() == 2025);
+    CHECK(zuu::parse_rfc3164_timestamp("Feb 29 00:00:00", DateTime(2024, 3, 1)));
+    CHECK(!zuu::parse_rfc3164_timestamp("Feb 29 00:00:00", DateTime(2023, 3, 1)));
+    CHECK(zuu::parse_rfc3164_timestamp("Dec 31 23:59:60", reference)->local.second() == 59);
+    CHECK(!zuu::parse_rfc3164_timestamp("Dec 31 15:59:60", reference));
+
+    const char* bad[] = {
+        "Oct 11 22:14:15 ", "Oct 11 22:14", "Oct-11 22:14:15", "Oct 11T22:14:15", "Oct 1 22:14:15",
+        "oct 11 22:14:15", "Oct 11 22.14.15", "Oct 32 22:14:15", "Oct 11 25:14:15", "Oct  0 22:14:15",
+    };
+    for (const char* s : bad) {
+        ++test::checks;
+        if (zuu::parse_rfc3164_timestamp(s, reference)) test::fail(__FILE__, __LINE__, s);
+    }
+}
+
+// ============================================================================
+// RFC 5424 / RFC 3339
+// ============================================================================
+
+std::string rfc3339(const DateTime& dt, int digits, int32_t offset, bool zulu) {
+    char buf[48];
+    int n = std::snprintf(buf, sizeof buf, "%04d-%02d-%02dT%02d:%02d:%02d", dt.year(), dt.month(), dt.day(),
+                          dt.hour(), dt.minute(), dt.second());
+    std::string s(buf, static_cast<size_t>(n));
+    if (digits > 0) {
+        std::snprintf(buf, sizeof buf, "%09d", dt.nanosecond());
+        s += '.';
+        s.append(buf, static_cast<size_t>(digits));
+    }
+    return s + (zulu ? std::string("Z") : offset_text(offset, true));
+}
+
+void check_rfc5424() {
+    for (int i = 0; i < 50000; ++i) {
+        const int digits = static_cast<int>(rng() % 10);   // 0 = no fraction
+        const DateTime dt = random_datetime(digits);
+        const bool zulu = rng() % 3 == 0;
+        const int32_t offset = zulu ? 0 : random_offset();
+        CHECK(zuu::parse_rfc5424_timestamp(rfc3339(dt, digits, offset, zulu)) == (OffsetDateTime{dt, offset}));
+    }
+
+    // Every fraction length, each keeping all its digits
+    const char* fractions[] = {"1", "12", "123", "1234", "12345", "123456", "1234567", "12345678", "123456789"};
+    const int nanos[] = {100000000, 120000000, 123000000, 123400000, 123450000, 123456000, 123456700, 123456780, 123456789};
+    for (int i = 0; i < 9; ++i) {
+        std::string s = std::string("2003-10-11T22:14:15.") + fractions[i] + "Z";
+        auto r = zuu::parse_rfc5424_timestamp(s);
+        CHECK(r && r->local == DateTime(2003, 10, 11, 22, 14, 15, nanos[i]));
+    }
+
+    // The RFC examples
+    CHECK(zuu::parse_rfc5424_timestamp("2003-10-11T22:14:15.003Z") ==
+          (OffsetDateTime{DateTime(2003, 10, 11, 22, 14, 15, 3000000), 0}));
+    auto r = zuu::parse_rfc5424_timestamp("2003-08-24T05:14:15.000003-07:00");
+    CHECK(r == (OffsetDateTime{DateTime(2003, 8, 24, 5, 14, 15, 3000), -420}));
+    CHECK(r && r->to_utc() == DateTime(2003, 8, 24, 12, 14, 15, 3000));
+    CHECK(zuu::parse_rfc5424_timestamp("1990-12-31T23:59:60Z") ==
+          (OffsetDateTime{DateTime(1990, 12, 31, 23, 59, 59), 0}));
+    CHECK(zuu::parse_rfc5424_timestamp("1990-12-31T15:59:60-08:00") ==
+          (OffsetDateTime{DateTime(1990, 12, 31, 15, 59, 59), -480}));
+    CHECK(zuu::parse_rfc5424_timestamp("1990-12-31T23:59:60.5Z")->local.nanosecond() == 500000000);
+    CHECK(!zuu::parse_rfc5424_timestamp("1990-12-31T15:59:60Z"));
+    CHECK(!zuu::parse_rfc5424_timestamp("1990-12-31T23:59:60+01:00"));
+
+    const char* bad[] = {
+        "-",                                    // NILVALUE
+        "2003-10-11T22:14:15",                  // no zone
+        "2003-10-11T22:14:15.Z",                // empty fraction
+        "2003-10-11T22:14:15.1234567890Z",      // ten fraction digits
+        "2003-10-11T22:14:15,003Z",
+        "2003-10-11T22:14:15.003z",
+        "2003-10-11T22:14:15.003ZZ",
+        "2003-10-11T22:14:15.003 Z",
+        "2003-10-11t22:14:15Z",                 // separators
+        "2003-10-11 22:14:15Z",
+        "2003/10/11T22:14:15Z",
+        "2003-10-11T22.14.15Z",
+        "2003-10-11T22:14:15+0700",             // offsets
+        "2003-10-11T22:14:15+07",
+        "2003-10-11T22:14:15+07:0",
+        "2003-10-11T22:14:15+24:00",
+        "2003-10-11T22:14:15+07:60",
+        "2003-10-11T22:14:15~07:00",
+        "2003-10-11T22:14:15+07:00 ",
+        "2003-02-29T22:14:15Z",                 // fields
+        "2003-13-11T22:14:15Z",
+        "2003-10-11T24:14:15Z",
+        "2003-10-11T22:14:61Z",
+        "0000-10-11T22:14:15Z",
+        "03-10-11T22:14:15Z",
+    };
+    for (const char* s : bad) {
+        ++test::checks;
+        if (zuu::parse_rfc5424_timestamp(s)) test::fail(__FILE__, __LINE__, s);
+    }
+}
+
+} // namespace
+
+int main() {
+    check_clf();
+    check_rfc3164();
+    check_rfc5424();
+    return test::finish();
+}
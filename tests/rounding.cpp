@@ -0,0 +1,260 @@
+/**
+ * @file rounding.cpp
+ * @brief floor / ceil / round against 128-bit and serial-day references
+ *
+ * Duration steps (divisors of a day, whole days and steps that are
+ * neither) are checked on int64 nanoseconds, Time and DateTime against
+ * the same rounding done on 128-bit nanoseconds since the epoch, including
+ * saturation at the int64 limits. Calendar units are checked against unit
+ * starts found by walking serial days, over random dates and every day
+ * near 0001-01-01 and 9999-12-31.
+ */
+
+#include "test_check.hpp"
+#include "../rounding.hpp"
+#include <limits>
+#include <random>
+#include <vector>
+
+namespace {
+
+using zuu::CalendarUnit;
+using zuu::Date;
+using zuu::DateTime;
+using zuu::Duration;
+using zuu::Time;
+using i128 = __int128;
+
+constexpr int64_t I64_MIN = std::numeric_limits<int64_t>::min();
+constexpr int64_t I64_MAX = std::numeric_limits<int64_t>::max();
+constexpr int64_t NS_PER_DAY = static_cast<int64_t>(zuu::detail::NANOS_PER_DAY);
+
+enum class Mode { Floor, Ceil, Nearest };
+
+std::mt19937_64 rng(49);
+
+i128 floor_mod(i128 a, i128 m) {
+    i128 r = a % m;
+    return r < 0 ? r + m : r;
+}
+
+/// Rounded value on the grid of multiples of step, in 128 bits
+i128 reference(i128 x, i128 step, Mode mode) {
+    i128 rem = floor_mod(x, step);
+    i128 lo = x - rem;
+    if (rem == 0 || mode == Mode::Floor) return lo;
+    if (mode == Mode::Ceil || rem >= step - rem) return lo + step;
+    return lo;
+}
+
+int64_t random_step() {
+    static const int64_t fixed[] = {
+        1, 3, 1000, 15 * int64_t{1000000000}, 3600 * int64_t{1000000000}, NS_PER_DAY, 7 * NS_PER_DAY,
+        NS_PER_DAY + 1, NS_PER_DAY - 1, 7 * int64_t{1000000000}, 200 * 365 * NS_PER_DAY, I64_MAX,
+    };
+    if (rng() % 2) return fixed[rng() % std::size(fixed)];
+    return static_cast<int64_t>(rng() % (uint64_t{1} << (rng() % 63))) + 1;
+}
+
+// ============================================================================
+// int64 nanoseconds
+// ============================================================================
+
+int64_t round_i64(int64_t ns, const Duration& step, Mode mode) {
+    const int64_t in[1] = {ns};
+    int64_t out[1] = {0};
+    switch (mode) {
+        case Mode::Floor: zuu::floor(std::span<const int64_t>(in), std::span<int64_t>(out), step); break;
+        case Mode::Ceil: zuu::ceil(std::span<const int64_t>(in), std::span<int64_t>(out), step); break;
+        case Mode::Nearest: zuu::round(std::span<const int64_t>(in), std::span<int64_t>(out), step); break;
+    }
+    return out[0];
+}
+
+void check_nanos(int64_t ns, int64_t step) {
+    for (Mode mode : {Mode::Floor, Mode::Ceil, Mode::Nearest}) {
+        i128 expected = reference(ns, step, mode);
+        if (expected < I64_MIN) expected = I64_MIN;
+        if (expected > I64_MAX) expected = I64_MAX;
+        CHECK(round_i64(ns, Duration(step), mode) == static_cast<int64_t>(expected));
+    }
+}
+
+void check_nanos_extremes() {
+    CHECK(round_i64(I64_MIN, Duration(3), Mode::Floor) == I64_MIN);
+    CHECK(round_i64(I64_MIN, Duration(3), Mode::Ceil) == I64_MIN + 2);
+    CHECK(round_i64(I64_MAX, Duration(3), Mode::Ceil) == I64_MAX);
+    CHECK(round_i64(I64_MAX, Duration(3), Mode::Floor) == I64_MAX - 1);
+    CHECK(round_i64(I64_MAX, Duration(I64_MAX), Mode::Floor) == I64_MAX);
+    CHECK(round_i64(-1, Duration(I64_MAX), Mode::Floor) == -I64_MAX);
+    CHECK(round_i64(I64_MIN, Duration(I64_MAX), Mode::Nearest) == -I64_MAX);
+    CHECK(round_i64(I64_MIN, Duration(I64_MAX), Mode::Floor) == I64_MIN);   // -2 * I64_MAX saturates
+    CHECK(round_i64(1, Duration(I64_MAX), Mode::Ceil) == I64_MAX);
+    CHECK(round_i64(-7, Duration(2), Mode::Nearest) == -6);   // ties round up
+
+    for (int64_t ns : {I64_MIN, I64_MIN + 1, I64_MAX, I64_MAX - 1, int64_t{0}, int64_t{-1}}) {
+        for (int i = 0; i < 200; ++i) check_nanos(ns, random_step());
+    }
+    for (int i = 0; i < 200000; ++i) check_nanos(static_cast<int64_t>(rng()), random_step());
+}
+
+// ============================================================================
+// Time and DateTime with Duration steps
+// ============================================================================
+
+i128 epoch_nanos(const DateTime& dt) {
+    return i128{dt.get_date().to_unix_days()} * NS_PER_DAY + dt.get_time().total_nanoseconds();
+}
+
+/// DateTime at 128-bit epoch nanos, or dt itself if outside 0001..9999
+DateTime from_epoch_nanos(i128 ns, const DateTime& dt) {
+    i128 days = ns / NS_PER_DAY, tod = ns % NS_PER_DAY;
+    if (tod < 0) { --days; tod += NS_PER_DAY; }
+    if (days < zuu::detail::MIN_UNIX_DAYS || days > zuu::detail::MAX_UNIX_DAYS) return dt;
+    return DateTime(Date::from_unix_days(static_cast<int32_t>(days)), Time(zuu::unchecked, static_cast<uint64_t>(tod)));
+}
+
+DateTime random_datetime() {
+    int64_t span = zuu::detail::MAX_UNIX_DAYS - zuu::detail::MIN_UNIX_DAYS + 1;
+    int64_t days = zuu::detail::MIN_UNIX_DAYS + static_cast<int64_t>(rng() % static_cast<uint64_t>(span));
+    if (rng() % 4 == 0) days = rng() % 2 ? zuu::detail::MIN_UNIX_DAYS + static_cast<int64_t>(rng() % 8)
+                                         : zuu::detail::MAX_UNIX_DAYS - static_cast<int64_t>(rng() % 8);
+    uint64_t tod = rng() % zuu::detail::NANOS_PER_DAY;
+    if (rng() % 8 == 0) tod = 0;
+    return DateTime(Date::from_unix_days(static_cast<int32_t>(days)), Time(zuu::unchecked, tod));
+}
+
+void check_datetime_step(const DateTime& dt, int64_t step) {
+    const Duration d(step);
+    CHECK(zuu::floor(dt, d) == from_epoch_nanos(reference(epoch_nanos(dt), step, Mode::Floor), dt));
+    CHECK(zuu::ceil(dt, d) == from_epoch_nanos(reference(epoch_nanos(dt), step, Mode::Ceil), dt));
+    CHECK(zuu::round(dt, d) == from_epoch_nanos(reference(epoch_nanos(dt), step, Mode::Nearest), dt));
+
+    // Time rounds on a grid anchored at midnight and wraps to 00:00
+    const Time t = dt.get_time();
+    const i128 tod = t.total_nanoseconds();
+    for (Mode mode : {Mode::Floor, Mode::Ceil, Mode::Nearest}) {
+        i128 r = reference(tod, step, mode);
+        if (r >= NS_PER_DAY) r = 0;
+        Time got = mode == Mode::Floor ? zuu::floor(t, d) : mode == Mode::Ceil ? zuu::ceil(t, d) : zuu::round(t, d);
+        CHECK(got.total_nanoseconds() == static_cast<uint64_t>(r));
+    }
+}
+
+void check_duration_steps() {
+    for (int i = 0; i < 200000; ++i) check_datetime_step(random_datetime(), random_step());
+
+    CHECK_THROWS(zuu::floor(DateTime(2024, 1, 1), Duration()), std::invalid_argument);
+    CHECK_THROWS(zuu::ceil(Time(12, 0, 0), Duration(-1)), std::invalid_argument);
+    std::vector<DateTime> in(3, DateTime(2024, 1, 1)), out(2);
+    CHECK_THROWS(zuu::floor(std::span<const DateTime>(in), std::span<DateTime>(out), Duration(1)), std::invalid_argument);
+}
+
+// ============================================================================
+// Calendar units
+// ============================================================================
+
+/// Start of the unit containing d, found by walking back one day at a time
+Date reference_start(const Date& d, CalendarUnit unit) {
+    auto starts = [unit](const Date& x) {
+        switch (unit) {
+            case CalendarUnit::Day: return true;
+            case CalendarUnit::Week: return x.day_of_week() == 0;
+            case CalendarUnit::Month: return x.day() == 1;
+            case CalendarUnit::Quarter: return x.day() == 1 && (x.month() - 1) % 3 == 0;
+            case CalendarUnit::Year: return x.day() == 1 && x.month() == 1;
+        }
+        return true;
+    };
+    int32_t days = d.to_unix_days();
+    while (!starts(Date::from_unix_days(days))) --days;
+    return Date::from_unix_days(days);
+}
+
+/// Serial day of the following unit's start, which may lie past 9999-12-31
+int64_t reference_next(const Date& start, CalendarUnit unit) {
+    int y = start.year(), m = start.month();
+    switch (unit) {
+        case CalendarUnit::Day: return int64_t{start.to_unix_days()} + 1;
+        case CalendarUnit::Week: return int64_t{start.to_unix_days()} + 7;
+        case CalendarUnit::Month: m += 1; break;
+        case CalendarUnit::Quarter: m += 3; break;
+        case CalendarUnit::Year: y += 1; break;
+    }
+    if (m > 12) { m -= 12; ++y; }
+    return zuu::days_from_civil(y, m, 1);
+}
+
+void check_calendar(const DateTime& dt, CalendarUnit unit) {
+    const Date start = reference_start(dt.get_date(), unit);
+    const int64_t next_days = reference_next(start, unit);
+    const bool has_next = next_days <= zuu::detail::MAX_UNIX_DAYS;
+    const DateTime lo(start);
+    const bool on_start = dt == lo;
+    // Rounding up past 9999-12-31 leaves the value unchanged
+    const DateTime hi = has_next ? DateTime(Date::from_unix_days(static_cast<int32_t>(next_days))) : dt;
+
+    CHECK(zuu::floor(dt, unit) == lo);
+    CHECK(zuu::ceil(dt, unit) == (on_start ? dt : hi));
+    const i128 below = epoch_nanos(dt) - epoch_nanos(lo);
+    const i128 above = i128{next_days} * NS_PER_DAY - epoch_nanos(dt);
+    CHECK(zuu::round(dt, unit) == (on_start || below < above ? lo : hi));
+
+    CHECK(zuu::floor(dt.get_date(), unit) == start);
+    const bool date_on_start = dt.get_date() == start;
+    CHECK(zuu::ceil(dt.get_date(), unit) == (date_on_start ? dt.get_date() : hi.get_date()));
+}
+
+void check_calendar_units() {
+    const CalendarUnit units[] = {
+        CalendarUnit::Day, CalendarUnit::Week, CalendarUnit::Month, CalendarUnit::Quarter, CalendarUnit::Year,
+    };
+    // Every day of the first and last 400 days, at midnight, noon and the last nanosecond
+    const uint64_t tods[] = {0, zuu::detail::NANOS_PER_DAY / 2, zuu::detail::NANOS_PER_DAY - 1};
+    for (int32_t i = 0; i < 400; ++i) {
+        for (int32_t days : {zuu::detail::MIN_UNIX_DAYS + i, zuu::detail::MAX_UNIX_DAYS - i}) {
+            for (uint64_t tod : tods) {
+                DateTime dt(Date::from_unix_days(days), Time(zuu::unchecked, tod));
+                for (CalendarUnit unit : units) check_calendar(dt, unit);
+            }
+        }
+    }
+    for (int i = 0; i < 50000; ++i) {
+        DateTime dt = random_datetime();
+        for (CalendarUnit unit : units) check_calendar(dt, unit);
+    }
+
+    // Fixed points at both ends of the range
+    const DateTime first(1, 1, 1), last(9999, 12, 31, 23, 59, 59, 999999999);
+    CHECK(zuu::floor(DateTime(1, 1, 3, 5), CalendarUnit::Week) == first);   // 0001-01-01 is a Monday
+    CHECK(zuu::floor(last, CalendarUnit::Week) == DateTime(9999, 12, 27));
+    CHECK(zuu::floor(last, CalendarUnit::Quarter) == DateTime(9999, 10, 1));
+    CHECK(zuu::floor(last, CalendarUnit::Year) == DateTime(9999, 1, 1));
+    CHECK(zuu::ceil(last, CalendarUnit::Week) == last);
+    CHECK(zuu::ceil(last, CalendarUnit::Quarter) == last);
+    CHECK(zuu::ceil(last, CalendarUnit::Year) == last);
+    CHECK(zuu::round(DateTime(9999, 12, 30), CalendarUnit::Year) == DateTime(9999, 12, 30));
+    CHECK(zuu::round(DateTime(9999, 5, 1), CalendarUnit::Year) == DateTime(9999, 1, 1));
+    CHECK(zuu::ceil(first, CalendarUnit::Year) == first);
+    CHECK(zuu::ceil(DateTime(1, 1, 1, 0, 0, 0, 1), CalendarUnit::Quarter) == DateTime(1, 4, 1));
+    CHECK(zuu::round(DateTime(2024, 7, 2), CalendarUnit::Year) == DateTime(2025, 1, 1));   // 183 of 366 days: tie rounds up
+    CHECK(zuu::round(DateTime(2024, 7, 1, 23, 59, 59), CalendarUnit::Year) == DateTime(2024, 1, 1));
+    CHECK(zuu::round(DateTime(2023, 7, 2, 11), CalendarUnit::Year) == DateTime(2023, 1, 1));
+
+    // Batch calls match the scalar ones
+    std::vector<DateTime> in(1000), out(1000);
+    for (auto& dt : in) dt = random_datetime();
+    zuu::round(std::span<const DateTime>(in), std::span<DateTime>(out), CalendarUnit::Quarter);
+    for (size_t i = 0; i < in.size(); ++i) CHECK(out[i] == zuu::round(in[i], CalendarUnit::Quarter));
+    zuu::ceil(std::span<const DateTime>(in), std::span<DateTime>(out), Duration::from_minutes(7));
+    for (size_t i = 0; i < in.size(); ++i) CHECK(out[i] == zuu::ceil(in[i], Duration::from_minutes(7)));
+}
+
+} // namespace
+
+int main() {
+    check_nanos_extremes();
+    check_duration_steps();
+    check_calendar_units();
+    return test::finish();
+}
@@ -0,0 +1,212 @@
+/**
+ * @file simd_kernels.cpp
+ * @brief Differential test of the bulk column and timestamp kernels
+ *
+ * Checks validate_dates(), validate_datetimes(), columns_to_unix_days(),
+ * columns_to_unix_nanos() and timestamp_stats() against scalar references
+ * built from is_valid_date(), is_valid_time(), Date::to_unix_days() and
+ * DateTime::to_unix_nanos(), on random and edge-case rows at lengths and
+ * offsets that hit both the 8-row vector blocks and the scalar tails.
+ *
+ * CMake builds this file twice, once as configured and once with -mavx2
+ * when the compiler accepts it, so both kernel paths are covered.
+ *
+ * Exits non-zero and prints the first mismatches if anything disagrees.
+ */
+
+#include "../datetime_columns.hpp"
+#include "../timestamp_stats.hpp"
+#include <climits>
+#include <cstdio>
+#include <random>
+#include <string>
+#include <vector>
+
+namespace {
+
+constexpr int MAX_REPORTS = 20;
+
+int failures = 0;
+int checks = 0;
+
+void report(const std::string& where, const char* what) {
+    if (failures++ >= MAX_REPORTS) return;
+    std::fprintf(stderr, "FAIL %s: %s\n", where.c_str(), what);
+}
+
+#define KERNEL_CHECK(cond)                   \
+    do {                                     \
+        ++checks;                            \
+        if (!(cond)) report(where, #cond);   \
+    } while (0)
+
+std::mt19937_64 rng(44);
+
+int32_t pick(int32_t lo, int32_t hi) {
+    return static_cast<int32_t>(lo + static_cast<int64_t>(rng() % static_cast<uint64_t>(int64_t{hi} - lo + 1)));
+}
+
+/// Mostly plausible values, some just out of range, a few extremes
+int32_t field(int32_t lo, int32_t hi) {
+    switch (rng() % 16) {
+        case 0: return pick(lo - 2, lo);
+        case 1: return pick(hi, hi + 2);
+        case 2: return (rng() & 1) ? INT32_MIN : INT32_MAX;
+        default: return pick(lo, hi);
+    }
+}
+
+struct Rows {
+    std::vector<int32_t> y, mo, d, h, mi, s, ns;
+
+    explicit Rows(size_t n) {
+        for (size_t i = 0; i < n; ++i) {
+            // Alternate the int64 nanosecond window, the full calendar and leap-year edges
+            switch (i % 3) {
+                case 0: y.push_back(field(1670, 2270)); break;
+                case 1: y.push_back(field(1, 9999)); break;
+                default: y.push_back(static_cast<int32_t>(100 * pick(0, 100) + pick(-1, 1))); break;
+            }
+            mo.push_back(field(1, 12));
+            d.push_back(field(1, 31));
+            h.push_back(field(0, 23));
+            mi.push_back(field(0, 59));
+            s.push_back(field(0, 59));
+            ns.push_back(field(0, 999'999'999));
+        }
+    }
+};
+
+void check_columns(const Rows& r, size_t offset, size_t n, bool with_ns) {
+    const std::string where = "columns n=" + std::to_string(n) + " offset=" + std::to_string(offset) +
+                              (with_ns ? "" : " no-ns");
+    auto col = [&](const std::vector<int32_t>& v) { return std::span<const int32_t>(v).subspan(offset, n); };
+    zuu::DateColumns dates{col(r.y), col(r.mo), col(r.d)};
+    zuu::TimeColumns times{col(r.h), col(r.mi), col(r.s), with_ns ? col(r.ns) : std::span<const int32_t>{}};
+
+    std::vector<uint64_t> date_bits(zuu::bitmap_words(n)), dt_bits(date_bits.size());
+    std::vector<uint64_t> day_bits(date_bits.size()), nano_bits(date_bits.size());
+    std::vector<int32_t> days(n, -1);
+    std::vector<int64_t> nanos(n, -1);
+    size_t date_count = zuu::validate_dates(dates, date_bits);
+    size_t dt_count = zuu::validate_datetimes(dates, times, dt_bits);
+    size_t day_count = zuu::columns_to_unix_days(dates, days, day_bits);
+    size_t nano_count = zuu::columns_to_unix_nanos(dates, times, nanos, nano_bits);
+
+    size_t want_date = 0, want_dt = 0, want_nano = 0;
+    for (size_t i = 0; i < n; ++i) {
+        const size_t k = offset + i;
+        const int ns_k = with_ns ? r.ns[k] : 0;
+        const bool date_ok = zuu::is_valid_date(r.y[k], r.mo[k], r.d[k]);
+        const bool dt_ok = date_ok && zuu::is_valid_time(r.h[k], r.mi[k], r.s[k], ns_k);
+        const int32_t serial = date_ok ? zuu::Date(r.y[k], r.mo[k], r.d[k]).to_unix_days() : 0;
+        const bool nano_ok = dt_ok && serial >= zuu::detail::MIN_NANOS_DAYS && serial <= zuu::detail::MAX_NANOS_DAYS;
+        const int64_t want_ns =
+            nano_ok ? zuu::DateTime(r.y[k], r.mo[k], r.d[k], r.h[k], r.mi[k], r.s[k], ns_k).to_unix_nanos() : 0;
+        want_date += date_ok;
+        want_dt += dt_ok;
+        want_nano += nano_ok;
+
+        KERNEL_CHECK(zuu::bitmap_test(date_bits, i) == date_ok);
+        KERNEL_CHECK(zuu::bitmap_test(dt_bits, i) == dt_ok);
+        KERNEL_CHECK(zuu::bitmap_test(day_bits, i) == date_ok);
+        KERNEL_CHECK(zuu::bitmap_test(nano_bits, i) == nano_ok);
+        KERNEL_CHECK(days[i] == serial);
+        KERNEL_CHECK(nanos[i] == want_ns);
+    }
+    KERNEL_CHECK(date_count == want_date);
+    KERNEL_CHECK(dt_count == want_dt);
+    KERNEL_CHECK(day_count == want_date);
+    KERNEL_CHECK(nano_count == want_nano);
+}
+
+/// Scalar reference for timestamp_stats()
+struct Reference {
+    int64_t min = INT64_MAX, max = INT64_MIN, mean = 0;
+    size_t out_of_order = 0;
+
+    explicit Reference(std::span<const int64_t> x) {
+        // floor(sum / n) exactly, as a running quotient and remainder
+        const int64_t n = static_cast<int64_t>(x.size());
+        int64_t q = 0, rem = 0;
+        for (size_t i = 0; i < x.size(); ++i) {
+            min = std::min(min, x[i]);
+            max = std::max(max, x[i]);
+            if (i > 0 && x[i] < x[i - 1]) ++out_of_order;
+            const int64_t qi = zuu::detail::floor_div(x[i], n);
+            q += qi;
+            rem += static_cast<int64_t>(static_cast<uint64_t>(x[i]) - static_cast<uint64_t>(qi) * static_cast<uint64_t>(n));
+            if (rem >= n) {
+                rem -= n;
+                ++q;
+            }
+        }
+        mean = q;
+    }
+};
+
+void check_stats(const std::string& name, std::span<const int64_t> x) {
+    const std::string where = "stats " + name + " n=" + std::to_string(x.size());
+    const Reference ref(x);
+    const zuu::TimestampStats s = zuu::timestamp_stats(x);
+    KERNEL_CHECK(s.count == x.size());
+    if (x.empty()) return;
+    KERNEL_CHECK(s.min == zuu::DateTime::from_unix_nanos(ref.min));
+    KERNEL_CHECK(s.max == zuu::DateTime::from_unix_nanos(ref.max));
+    KERNEL_CHECK(s.mean == zuu::DateTime::from_unix_nanos(ref.mean));
+    KERNEL_CHECK(s.out_of_order == ref.out_of_order);
+    int64_t span = 0;
+    if (x.size() > 1 && !zuu::detail::sub_overflow(x.back(), x.front(), span)) {
+        KERNEL_CHECK(s.mean_interarrival.total_nanoseconds() == span / static_cast<int64_t>(x.size() - 1));
+    }
+
+    // Chunks that start mid-array compare against their predecessor, as the threaded split does
+    for (size_t cut : {size_t{1}, size_t{9}, x.size() / 3, x.size() - 1}) {
+        if (cut == 0 || cut >= x.size()) continue;
+        zuu::detail::StatsPartial p = zuu::detail::reduce_nanos(x.data(), 0, cut);
+        p.merge(zuu::detail::reduce_nanos(x.data(), cut, x.size()));
+        KERNEL_CHECK(p.min == ref.min);
+        KERNEL_CHECK(p.max == ref.max);
+        KERNEL_CHECK(p.out_of_order == ref.out_of_order);
+        KERNEL_CHECK(zuu::detail::split_mean(p, x.size()) == ref.mean);
+    }
+}
+
+void check_stats_sets(size_t n) {
+    std::vector<int64_t> jitter(n), wide(n), falling(n), extremes(n);
+    int64_t t = zuu::DateTime(2024, 1, 1).to_unix_nanos();
+    for (size_t i = 0; i < n; ++i) {
+        t += 1'000'000;
+        jitter[i] = t + static_cast<int64_t>(rng() % 4'000'000) - 2'000'000;
+        wide[i] = static_cast<int64_t>(rng());
+        falling[i] = -static_cast<int64_t>(i) * 7;
+        extremes[i] = (rng() & 1) ? INT64_MAX - static_cast<int64_t>(rng() % 3)
+                                  : INT64_MIN + static_cast<int64_t>(rng() % 3);
+    }
+    check_stats("jitter", jitter);
+    check_stats("wide", wide);
+    check_stats("falling", falling);
+    check_stats("extremes", extremes);
+    check_stats("constant", std::vector<int64_t>(n, -1));
+}
+
+} // namespace
+
+int main() {
+    std::printf("AVX2 kernels: %s\n", ZUU_HAS_AVX2 ? "on" : "off");
+
+    const Rows rows(200'000 + 3);
+    for (size_t n : {0, 1, 7, 8, 9, 63, 64, 65, 127, 1000, 200'000}) {
+        for (size_t offset : {0, 1, 3}) {
+            check_columns(rows, offset, n, true);
+            check_columns(rows, offset, n, false);
+        }
+    }
+
+    for (size_t n = 0; n <= 40; ++n) check_stats_sets(n);
+    check_stats_sets(100'003);
+    check_stats_sets(3'000'001);   // several worker chunks where threads are available
+
+    std::printf("%d checks, %d failures\n", checks, failures);
+    return failures == 0 ? 0 : 1;
+}
@@ -0,0 +1,158 @@
+/**
+ * @file streaming_formatter.cpp
+ * @brief StreamingFormatter against DateTime::format
+ *
+ * Fixed and random patterns (every specifier, literals, %%, unknown
+ * specifiers, a trailing '%') format walks of nearby timestamps. Each walk
+ * starts just before a second, minute, hour, day, month or year boundary
+ * (up to 9999-12-31) and steps forward by nanoseconds to hours, with
+ * occasional steps back and jumps. Every call must produce exactly what
+ * DateTime::format() does with the same pattern.
+ */
+
+#include "test_check.hpp"
+#include "../streaming_formatter.hpp"
+#include <random>
+#include <string>
+
+namespace {
+
+using zuu::DateTime;
+using zuu::StreamingFormatter;
+
+constexpr int64_t NS_PER_SECOND = 1'000'000'000;
+constexpr int64_t NS_PER_MINUTE = 60 * NS_PER_SECOND;
+constexpr int64_t NS_PER_HOUR = 60 * NS_PER_MINUTE;
+
+const char* const SPECIFIERS[] = {"%Y", "%m", "%d", "%w", "%j", "%q", "%W", "%B", "%b", "%A", "%a",
+                                  "%H", "%M", "%S", "%f", "%u", "%N", "%%", "%x"};
+const char* const LITERALS[] = {"-", ":", " ", "T", ".", "Z", "[", "] ", "day "};
+
+const char* const PATTERNS[] = {
+    "%Y-%m-%d %H:%M:%S",
+    "%Y-%m-%dT%H:%M:%S.%NZ",
+    "%H:%M:%S.%f",
+    "%a, %d %b %Y %H:%M:%S",
+    "%A %B %d (day %j, week %W, Q%q, wd %w) %H:%M:%S.%u",
+    "%S%M%H%d%m%Y",
+    "%N %f %u",
+    "100%% at %H:%M %",
+    "",
+};
+
+std::mt19937_64 rng(37);
+
+int random_in(int lo, int hi) { return lo + static_cast<int>(rng() % static_cast<uint64_t>(hi - lo + 1)); }
+
+std::string random_pattern() {
+    std::string p;
+    for (int n = random_in(1, 12); n > 0; --n) {
+        p += rng() % 3 ? SPECIFIERS[rng() % std::size(SPECIFIERS)] : LITERALS[rng() % std::size(LITERALS)];
+    }
+    if (rng() % 8 == 0) p += '%';
+    return p;
+}
+
+/// A datetime just before a boundary of the given kind
+DateTime before_boundary(int kind) {
+    int y = random_in(1, 9999);
+    int mo = random_in(1, 12);
+    int d = random_in(1, zuu::days_in_month(mo, y));
+    int h = random_in(0, 23), mi = random_in(0, 59), s = random_in(0, 59);
+    switch (kind) {
+        case 0: break;                                                    // second
+        case 1: s = 59; break;                                            // minute
+        case 2: mi = 59; s = 59; break;                                   // hour
+        case 3: h = 23; mi = 59; s = 59; break;                           // day
+        case 4: d = zuu::days_in_month(mo, y); h = 23; mi = 59; s = 59; break;   // month
+        case 5: mo = 12; d = 31; h = 23; mi = 59; s = 59; break;          // year
+        case 6: y = 9999; mo = 12; d = 31; h = 23; mi = 59; s = 59; break;      // end of range
+        default: mo = 2; d = 28; h = 23; mi = 59; s = 59; break;          // into Feb 29 or Mar 1
+    }
+    return DateTime(y, mo, d, h, mi, s, random_in(999'000'000, 999'999'999));
+}
+
+int64_t random_step() {
+    switch (rng() % 6) {
+        case 0: return 1 + static_cast<int64_t>(rng() % 1000);
+        case 1: return static_cast<int64_t>(rng() % 1'000'000);
+        case 2: return static_cast<int64_t>(rng() % NS_PER_SECOND);
+        case 3: return static_cast<int64_t>(rng() % (90 * NS_PER_SECOND));
+        case 4: return static_cast<int64_t>(rng() % (2 * NS_PER_HOUR));
+        default: return 0;   // repeated value
+    }
+}
+
+void check_walk(StreamingFormatter& fmt, const std::string& pattern, DateTime dt, int steps) {
+    for (int i = 0; i < steps; ++i) {
+        ++test::checks;
+        const std::string expected = dt.format(pattern);
+        if (fmt.format(dt) != expected) {
+            const std::string what = "\"" + pattern + "\" at " + dt.to_iso8601_ns();
+            test::fail(__FILE__, __LINE__, what.c_str());
+        }
+
+        switch (rng() % 16) {
+            case 0: dt.add_nanoseconds(-random_step()); break;
+            case 1: dt = before_boundary(random_in(0, 7)); break;
+            default: dt.add_nanoseconds(random_step()); break;
+        }
+    }
+}
+
+// ============================================================================
+// Rollovers
+// ============================================================================
+
+void check_rollovers() {
+    for (const char* pattern : PATTERNS) {
+        StreamingFormatter fmt(pattern);
+        for (int kind = 0; kind < 8; ++kind) {
+            for (int i = 0; i < 300; ++i) check_walk(fmt, pattern, before_boundary(kind), 40);
+        }
+    }
+    for (int i = 0; i < 3000; ++i) {
+        const std::string pattern = random_pattern();
+        StreamingFormatter fmt(pattern);
+        check_walk(fmt, pattern, before_boundary(random_in(0, 7)), 100);
+    }
+}
+
+// ============================================================================
+// Exact rollover instants
+// ============================================================================
+
+void check_exact() {
+    const std::string pattern = "%Y-%m-%d %a %j %W %H:%M:%S.%N";
+    StreamingFormatter fmt(pattern);
+    const DateTime walk[] = {
+        DateTime(2023, 12, 31, 23, 59, 59, 999999999), DateTime(2024, 1, 1),
+        DateTime(2024, 1, 1, 0, 0, 0, 1),              DateTime(2024, 1, 1, 0, 0, 1),
+        DateTime(2024, 1, 1, 0, 1, 0),                 DateTime(2024, 1, 1, 1, 0, 0),
+        DateTime(2024, 1, 1, 1, 0, 0),                 DateTime(2024, 1, 1, 0, 59, 59, 999999999),
+        DateTime(2024, 2, 28, 23, 59, 59),             DateTime(2024, 2, 29),
+        DateTime(2024, 3, 1),                          DateTime(1, 1, 1),
+        DateTime(9999, 12, 31, 23, 59, 59, 999999999), DateTime(9999, 12, 31),
+    };
+    for (const DateTime& dt : walk) CHECK(fmt.format(dt) == dt.format(pattern));
+
+    // append_to and a compiled pattern give the same text; reset forgets the cache
+    StreamingFormatter compiled(zuu::FormatPattern("%H:%M:%S.%f"));
+    std::string out;
+    DateTime dt(2024, 6, 30, 23, 59, 59, 999000000);
+    compiled.append_to(dt, out);
+    dt.add_nanoseconds(1'000'000);
+    out += '|';
+    compiled.append_to(dt, out);
+    CHECK(out == "23:59:59.999|00:00:00.000");
+    compiled.reset();
+    CHECK(compiled.format(dt) == "00:00:00.000");
+}
+
+} // namespace
+
+int main() {
+    check_rollovers();
+    check_exact();
+    return test::finish();
+}
@@ -0,0 +1,51 @@
+/**
+ * @file test_check.hpp
+ * @brief Check macros shared by the single-threaded unit tests
+ *
+ * CHECK(cond) counts a check and prints the expression and line of the
+ * first failures; CHECK_THROWS(expr, type) expects expr to throw type.
+ * main() ends with `return test::finish();`, which prints the totals and
+ * returns non-zero if anything failed.
+ */
+
+#pragma once
+
+#include <cstdio>
+
+namespace test {
+
+constexpr int MAX_REPORTS = 20;
+
+inline int failures = 0;
+inline int checks = 0;
+
+inline void fail(const char* file, int line, const char* what) {
+    if (failures++ >= MAX_REPORTS) return;
+    std::fprintf(stderr, "FAIL %s:%d: %s\n", file, line, what);
+}
+
+inline int finish() {
+    std::printf("%d checks, %d failures\n", checks, failures);
+    return failures == 0 ? 0 : 1;
+}
+
+} // namespace test
+
+#define CHECK(cond)                                              \
+    do {                                                         \
+        ++test::checks;                                          \
+        if (!(cond)) test::fail(__FILE__, __LINE__, #cond);      \
+    } while (0)
+
+#define CHECK_THROWS(expr, type)                                                  \
+    do {                                                                          \
+        ++test::checks;                                                           \
+        bool thrown_ = false;                                                     \
+        try {                                                                     \
+            (void)(expr);                                                         \
+        } catch (const type&) {                                                   \
+            thrown_ = true;                                                       \
+        } catch (...) {                                                           \
+        }                                                                         \
+        if (!thrown_) test::fail(__FILE__, __LINE__, #expr " throws " #type);    \
+    } while (0)
@@ -0,0 +1,215 @@
+/**
+ * @file timestamp_stats.cpp
+ * @brief QuantileSketch error bounds and the timestamp_stats sum at scale
+ *
+ * Sketches of several sizes are fed uniform, clustered, heavy-tailed and
+ * monotonic inputs, with INT64_MIN and INT64_MAX mixed in, and every
+ * quantile is compared with the value at the same rank of the sorted
+ * input: the error must stay below the documented 2 * range / (Bins - 1),
+ * and be zero while the range is below Bins. Partial sums of more than
+ * 2^32 values, which no test can allocate, are merged by hand and must
+ * give the exact mean.
+ */
+
+#include "test_check.hpp"
+#include "../timestamp_stats.hpp"
+#include <algorithm>
+#include <limits>
+#include <random>
+#include <vector>
+
+namespace {
+
+using zuu::QuantileSketch;
+using i128 = __int128;
+
+constexpr int64_t I64_MIN = std::numeric_limits<int64_t>::min();
+constexpr int64_t I64_MAX = std::numeric_limits<int64_t>::max();
+constexpr int64_t NS_2024 = 1'704'067'200'000'000'000;   ///< 2024-01-01 in epoch nanoseconds
+
+const double QUANTILES[] = {0.0, 1e-6, 0.001, 0.01, 0.1, 0.25, 0.5, 0.75, 0.9, 0.99, 0.999, 1.0 - 1e-9, 1.0};
+
+std::mt19937_64 rng(50);
+
+int64_t random_in(int64_t lo, int64_t hi) {
+    return lo + static_cast<int64_t>(rng() % (static_cast<uint64_t>(hi) - static_cast<uint64_t>(lo) + 1));
+}
+
+std::vector<int64_t> random_input(int kind, size_t n) {
+    std::vector<int64_t> v(n);
+    switch (kind) {
+        case 0:   // whole int64 range
+            for (auto& x : v) x = static_cast<int64_t>(rng());
+            break;
+        case 1:   // one day of timestamps
+            for (auto& x : v) x = NS_2024 + random_in(0, 86'400'000'000'000);
+            break;
+        case 2: {   // inter-arrival gaps: exponential-ish with a few huge ones
+            std::exponential_distribution<double> gap(1e-6);
+            for (auto& x : v) x = rng() % 1000 ? static_cast<int64_t>(gap(rng)) : random_in(0, I64_MAX);
+            break;
+        }
+        case 3:   // timestamps with outliers at the int64 limits
+            for (auto& x : v) {
+                uint64_t r = rng() % 100;
+                x = r == 0 ? I64_MIN : r == 1 ? I64_MAX : NS_2024 + random_in(-1'000'000'000, 1'000'000'000);
+            }
+            break;
+        case 4:   // few distinct values
+            for (auto& x : v) x = random_in(-3, 3) * 1'000'003;
+            break;
+        case 5:   // descending, so the sketch keeps widening to the left
+            for (auto& x : v) x = random_in(I64_MIN / 2, I64_MAX / 2);
+            std::sort(v.rbegin(), v.rend());
+            break;
+        default:   // ascending, small values then the limits
+            for (auto& x : v) x = random_in(-1000, 1000);
+            std::sort(v.begin(), v.end());
+            v.push_back(I64_MAX);
+            v.push_back(I64_MIN);
+            break;
+    }
+    return v;
+}
+
+// ============================================================================
+// Quantile error bounds
+// ============================================================================
+
+template <size_t Bins>
+void check_sketch(const std::vector<int64_t>& input) {
+    QuantileSketch<Bins> sketch;
+    sketch.add(std::span<const int64_t>(input));
+    CHECK(sketch.count() == input.size());
+
+    std::vector<int64_t> sorted = input;
+    std::sort(sorted.begin(), sorted.end());
+    const i128 range = i128{sorted.back()} - sorted.front();
+    const i128 bound = range < static_cast<i128>(Bins) ? 0 : 2 * range / static_cast<i128>(Bins - 1);
+
+    auto check_q = [&](double q) {
+        const size_t rank = static_cast<size_t>(q * static_cast<double>(sorted.size() - 1));
+        const int64_t got = sketch.quantile(q);
+        const i128 err = i128{got} - sorted[rank];
+        ++test::checks;
+        if ((err < 0 ? -err : err) > bound || got < sorted.front() || got > sorted.back()) {
+            test::fail(__FILE__, __LINE__, "quantile further than 2 * range / (Bins - 1) from the sorted reference");
+        }
+    };
+    for (double q : QUANTILES) check_q(q);
+    for (int i = 0; i < 20; ++i) check_q(std::uniform_real_distribution<double>(0.0, 1.0)(rng));
+
+    CHECK(sketch.quantile(0.0) == sorted.front());
+    CHECK(sketch.quantile(1.0) == sorted.back());
+    CHECK(sketch.quantile(-1.0) == sorted.front());
+    CHECK(sketch.quantile(2.0) == sorted.back());
+
+    // Quantiles never decrease with q
+    int64_t prev = I64_MIN;
+    bool monotonic = true;
+    for (int i = 0; i <= 1000; ++i) {
+        int64_t v = sketch.quantile(i / 1000.0);
+        monotonic = monotonic && v >= prev;
+        prev = v;
+    }
+    CHECK(monotonic);
+}
+
+void check_quantiles() {
+    const size_t sizes[] = {1, 2, 3, 10, 1000, 100000};
+    for (int kind = 0; kind < 7; ++kind) {
+        for (size_t n : sizes) {
+            for (int rep = 0; rep < 4; ++rep) {
+                const std::vector<int64_t> input = random_input(kind, n);
+                check_sketch<4>(input);
+                check_sketch<16>(input);
+                check_sketch<2048>(input);
+            }
+        }
+    }
+
+    // Small integer ranges fit at width 1 and are exact
+    QuantileSketch<64> exact;
+    std::vector<int64_t> small;
+    for (int i = 0; i < 5000; ++i) small.push_back(random_in(-20, 20));
+    exact.add(std::span<const int64_t>(small));
+    std::sort(small.begin(), small.end());
+    for (double q : QUANTILES) {
+        CHECK(exact.quantile(q) == small[static_cast<size_t>(q * static_cast<double>(small.size() - 1))]);
+    }
+
+    // Just the limits
+    QuantileSketch<4> limits;
+    limits.add(I64_MAX);
+    limits.add(I64_MIN);
+    CHECK(limits.quantile(0.0) == I64_MIN && limits.quantile(1.0) == I64_MAX);
+    CHECK(limits.quantile(0.25) <= limits.quantile(0.75));
+
+    QuantileSketch<> empty;
+    CHECK(empty.empty() && empty.quantile(0.5) == 0);
+
+    // DateTime and Duration overloads feed the same nanoseconds
+    QuantileSketch<> by_time, by_nanos, by_duration;
+    for (int i = 0; i < 1000; ++i) {
+        const int64_t ns = NS_2024 + random_in(0, 1'000'000'000'000);
+        by_time.add(zuu::DateTime::from_unix_nanos(ns));
+        by_nanos.add(ns);
+        by_duration.add(zuu::Duration::from_nanoseconds(ns - NS_2024));
+    }
+    for (double q : QUANTILES) {
+        CHECK(by_time.quantile(q) == by_nanos.quantile(q));
+        CHECK(by_time.quantile_datetime(q) == zuu::DateTime::from_unix_nanos(by_nanos.quantile(q)));
+        CHECK(by_duration.quantile_duration(q).total_nanoseconds() >= 0);
+    }
+}
+
+// ============================================================================
+// Sums beyond 2^32 values
+// ============================================================================
+
+void check_large_sums() {
+    // One full block of INT64_MIN, as reduce_block leaves it
+    zuu::detail::StatsPartial block;
+    block.min = block.max = I64_MIN;
+    block.sum_lo = 0;
+    block.sum_hi = uint64_t{1} << 62;   // 2^31 values of 2^31
+    block.negatives = uint64_t{1} << 31;
+
+    zuu::detail::StatsPartial total;
+    for (int i = 0; i < 8; ++i) total.merge(block);   // 2^34 values: sum_hi alone would wrap at 4
+    CHECK(zuu::detail::split_mean(total, size_t{1} << 34) == I64_MIN);
+
+    // Mixed blocks: 2^31 copies each of -1 and INT64_MAX, repeated 3 times
+    zuu::detail::StatsPartial minus_one;
+    minus_one.sum_lo = (uint64_t{1} << 31) * 0xFFFFFFFFull;
+    minus_one.sum_hi = (uint64_t{1} << 31) * 0xFFFFFFFFull;
+    minus_one.negatives = uint64_t{1} << 31;
+    zuu::detail::StatsPartial max_block;
+    max_block.sum_lo = (uint64_t{1} << 31) * 0xFFFFFFFFull;
+    max_block.sum_hi = (uint64_t{1} << 31) * 0x7FFFFFFFull;
+    zuu::detail::StatsPartial mixed;
+    for (int i = 0; i < 3; ++i) {
+        mixed.merge(minus_one);
+        mixed.merge(max_block);
+    }
+    // Mean of equal counts of -1 and INT64_MAX is floor((INT64_MAX - 1) / 2)
+    CHECK(zuu::detail::split_mean(mixed, size_t{6} << 31) == (I64_MAX - 1) / 2);
+
+    // reduce_nanos itself, against a 128-bit sum
+    std::vector<int64_t> v(100000);
+    for (auto& x : v) x = rng() % 2 ? I64_MIN + random_in(0, 1000) : I64_MAX - random_in(0, 1000);
+    i128 sum = 0;
+    for (int64_t x : v) sum += x;
+    i128 mean = sum / static_cast<i128>(v.size());
+    if (sum % static_cast<i128>(v.size()) < 0) --mean;
+    const zuu::detail::StatsPartial p = zuu::detail::reduce_nanos(v.data(), 0, v.size());
+    CHECK(zuu::detail::split_mean(p, v.size()) == static_cast<int64_t>(mean));
+}
+
+} // namespace
+
+int main() {
+    check_quantiles();
+    check_large_sums();
+    return test::finish();
+}
@@ -10,8 +10,10 @@
 
 #include "datetime_config.hpp"
 #include <chrono>
+#include <optional>
 #include <string_view>
 #include <compare>
+#include <functional>
 
 namespace zuu {
 
@@ -68,6 +70,40 @@ public:
             throw std::out_of_range("Nanoseconds exceed 24 hours");
         }
     }
+    
+    /**
+     * @brief Construct from components already known to be valid (no checks)
+     * @pre is_valid_time(h, min, s, ns)
+     */
+    constexpr Time(unchecked_t, int h, int min, int s = 0, int ns = 0) noexcept
+        : total_nanos_(static_cast<uint64_t>(h) * detail::NANOS_PER_HOUR +
+                       static_cast<uint64_t>(min) * detail::NANOS_PER_MINUTE +
+                       static_cast<uint64_t>(s) * detail::NANOS_PER_SECOND +
+                       static_cast<uint64_t>(ns)) {}
+    
+    /**
+     * @brief Construct from nanoseconds since midnight already known to be in range (no checks)
+     * @pre nanos < 86400000000000
+     */
+    constexpr Time(unchecked_t, uint64_t nanos) noexcept : total_nanos_(nanos) {}
+    
+    /**
+     * @brief Construct time from components without throwing
+     * @return Time, or std::nullopt if any component is invalid
+     */
+    [[nodiscard]] static constexpr std::optional<Time> try_make(int h, int min, int s = 0, int ns = 0) noexcept {
+        if (!is_valid_time(h, min, s, ns)) return std::nullopt;
+        return Time(unchecked, h, min, s, ns);
+    }
+    
+    /**
+     * @brief Construct from total nanoseconds since midnight without throwing
+     * @return Time, or std::nullopt if nanos is 24 hours or more
+     */
+    [[nodiscard]] static constexpr std::optional<Time> try_make(uint64_t nanos) noexcept {
+        if (nanos >= detail::NANOS_PER_DAY) return std::nullopt;
+        return Time(unchecked, nanos);
+    }
 
     // ========================================================================
     // Component Accessors
@@ -174,7 +210,7 @@ public:
         nanos %= detail::NANOS_PER_DAY;
         if (nanos < 0) nanos += detail::NANOS_PER_DAY;
         
-        return Time(static_cast<uint64_t>(nanos));
+        return Time(unchecked, static_cast<uint64_t>(nanos));
     }
     
     /**
@@ -185,7 +221,7 @@ public:
     [[nodiscard]] static constexpr Time from_seconds(int64_t seconds) noexcept {
         seconds %= detail::SECONDS_PER_DAY;
         if (seconds < 0) seconds += detail::SECONDS_PER_DAY;
-        return Time(static_cast<uint64_t>(seconds) * detail::NANOS_PER_SECOND);
+        return Time(unchecked, static_cast<uint64_t>(seconds) * detail::NANOS_PER_SECOND);
     }
     
     /**
@@ -197,7 +233,7 @@ public:
         int64_t nanos = milliseconds * detail::NANOS_PER_MILLISECOND;
         nanos %= detail::NANOS_PER_DAY;
         if (nanos < 0) nanos += detail::NANOS_PER_DAY;
-        return Time(static_cast<uint64_t>(nanos));
+        return Time(unchecked, static_cast<uint64_t>(nanos));
     }
 
     // ========================================================================
@@ -265,6 +301,39 @@ public:
         return *this;
     }
 
+    // ========================================================================
+    // std::chrono Interop
+    // ========================================================================
+    
+    /**
+     * @brief Convert to time since midnight as std::chrono::nanoseconds
+     */
+    [[nodiscard]] constexpr std::chrono::nanoseconds to_duration() const noexcept {
+        return std::chrono::nanoseconds(static_cast<int64_t>(total_nanos_));
+    }
+    
+    /**
+     * @brief Convert to std::chrono::hh_mm_ss
+     */
+    [[nodiscard]] constexpr std::chrono::hh_mm_ss<std::chrono::nanoseconds> to_hh_mm_ss() const noexcept {
+        return std::chrono::hh_mm_ss<std::chrono::nanoseconds>(to_duration());
+    }
+    
+    /**
+     * @brief Create Time from std::chrono::hh_mm_ss
+     * @param hms Time of day (must be non-negative and below 24 hours)
+     * @return Time object
+     * @throw std::out_of_range if hms is negative or not below 24 hours
+     */
+    template <typename Dur>
+    [[nodiscard]] static constexpr Time from_hh_mm_ss(const std::chrono::hh_mm_ss<Dur>& hms) {
+        if (hms.is_negative()) {
+            throw std::out_of_range("Negative time of day");
+        }
+        return Time(static_cast<uint64_t>(
+            std::chrono::duration_cast<std::chrono::nanoseconds>(hms.to_duration()).count()));
+    }
+
     // ========================================================================
     // Formatting
     // ========================================================================
@@ -390,3 +459,14 @@ public:
 };
 
 } // namespace zuu
+
+/**
+ * @brief Hash for zuu::Time
+ */
+template <>
+struct std::hash<zuu::Time> {
+    [[nodiscard]] constexpr size_t operator()(const zuu::Time& t) const noexcept {
+        return static_cast<size_t>(zuu::detail::hash_mix(t.total_nanoseconds()));
+    }
+};
+
@@ -0,0 +1,390 @@
+/**
+ * @file timestamp_stats.hpp
+ * @brief Single-pass statistics and quantile sketches over timestamp arrays
+ * @author zuudevs (zuudevs@gmail.com)
+ * @version 1.1.1
+ * @date 2026-10-16
+ */
+
+#pragma once
+
+#include "datetime_core.hpp"
+#include "datetime_parallel.hpp"
+#include "duration_core.hpp"
+#include <algorithm>
+#include <array>
+#include <cmath>
+#include <limits>
+#include <span>
+#include <vector>
+
+namespace zuu {
+
+/**
+ * @brief Summary of a timestamp array
+ */
+struct TimestampStats {
+    size_t count = 0;             ///< Number of timestamps
+    DateTime min;                 ///< Earliest timestamp
+    DateTime max;                 ///< Latest timestamp
+    DateTime mean;                ///< Mean timestamp (floor to the nanosecond)
+    Duration mean_interarrival;   ///< Mean gap between consecutive entries, in input order
+    size_t out_of_order = 0;      ///< Entries earlier than their predecessor
+};
+
+namespace detail {
+
+#if defined(__SIZEOF_INT128__)
+    using stats_sum = __int128;
+#else
+    using stats_sum = long double;
+#endif
+
+    /// Values per block of split sums; 2^31 * (2^32 - 1) cannot wrap a uint64
+    constexpr size_t STATS_BLOCK = size_t{1} << 31;
+
+    /// Partial reduction over one chunk of epoch nanoseconds
+    struct StatsPartial {
+        int64_t min = std::numeric_limits<int64_t>::max();
+        int64_t max = std::numeric_limits<int64_t>::min();
+        uint64_t sum_lo = 0;      ///< Sum of the low 32 bits (at most STATS_BLOCK values)
+        uint64_t sum_hi = 0;      ///< Sum of the high 32 bits, as unsigned (at most STATS_BLOCK values)
+        uint64_t negatives = 0;   ///< Values below zero (each adds 2^64 to sum_hi * 2^32)
+        stats_sum sum = 0;        ///< Total of the blocks already folded in
+        size_t out_of_order = 0;
+
+        /// Exact sum of the split sums
+        [[nodiscard]] stats_sum block_sum() const noexcept {
+            constexpr auto two_32 = static_cast<stats_sum>(uint64_t{1} << 32);
+            return static_cast<stats_sum>(sum_hi) * two_32 + static_cast<stats_sum>(sum_lo) -
+                   static_cast<stats_sum>(negatives) * two_32 * two_32;
+        }
+
+        [[nodiscard]] stats_sum total() const noexcept { return sum + block_sum(); }
+
+        void merge(const StatsPartial& o) noexcept {
+            min = std::min(min, o.min);
+            max = std::max(max, o.max);
+            sum += o.total();
+            out_of_order += o.out_of_order;
+        }
+    };
+
+    /// Reduce x[b, e) (at most STATS_BLOCK values), counting pairs (i - 1, i) for i in [max(b, 1), e)
+    inline StatsPartial reduce_block(const int64_t* x, size_t b, size_t e) noexcept {
+        StatsPartial p;
+        size_t i = b;
+#if ZUU_HAS_AVX2
+        if (e - b >= 16) {
+            const __m256i low_mask = _mm256_set1_epi64x(0xFFFFFFFFll);
+            const __m256i zero = _mm256_setzero_si256();
+            __m256i vmin = _mm256_set1_epi64x(p.min);
+            __m256i vmax = _mm256_set1_epi64x(p.max);
+            __m256i vlo = zero, vhi = zero, vneg = zero, vooo = zero;
+            if (i == 0) {   // the first element has no predecessor
+                p.min = p.max = x[0];
+                p.sum_lo = static_cast<uint64_t>(x[0]) & 0xFFFFFFFFull;
+                p.sum_hi = static_cast<uint64_t>(x[0]) >> 32;
+                p.negatives = x[0] < 0;
+                i = 1;
+            }
+            // Two min/max accumulators hide the compare + blend latency
+            __m256i vmin2 = vmin, vmax2 = vmax;
+            for (; i + 8 <= e; i += 8) {
+                __m256i cur = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(x + i));
+                __m256i cur2 = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(x + i + 4));
+                __m256i prev = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(x + i - 1));
+                __m256i prev2 = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(x + i + 3));
+                vmin = _mm256_blendv_epi8(vmin, cur, _mm256_cmpgt_epi64(vmin, cur));
+                vmax = _mm256_blendv_epi8(vmax, cur, _mm256_cmpgt_epi64(cur, vmax));
+                vmin2 = _mm256_blendv_epi8(vmin2, cur2, _mm256_cmpgt_epi64(vmin2, cur2));
+                vmax2 = _mm256_blendv_epi8(vmax2, cur2, _mm256_cmpgt_epi64(cur2, vmax2));
+                vlo = _mm256_add_epi64(vlo, _mm256_add_epi64(_mm256_and_si256(cur, low_mask), _mm256_and_si256(cur2, low_mask)));
+                vhi = _mm256_add_epi64(vhi, _mm256_add_epi64(_mm256_srli_epi64(cur, 32), _mm256_srli_epi64(cur2, 32)));
+                vneg = _mm256_sub_epi64(vneg, _mm256_add_epi64(_mm256_cmpgt_epi64(zero, cur), _mm256_cmpgt_epi64(zero, cur2)));
+                vooo = _mm256_sub_epi64(vooo, _mm256_add_epi64(_mm256_cmpgt_epi64(prev, cur), _mm256_cmpgt_epi64(prev2, cur2)));
+            }
+            vmin = _mm256_blendv_epi8(vmin, vmin2, _mm256_cmpgt_epi64(vmin, vmin2));
+            vmax = _mm256_blendv_epi8(vmax, vmax2, _mm256_cmpgt_epi64(vmax2, vmax));
+            alignas(32) int64_t lanes[6][4];
+            _mm256_store_si256(reinterpret_cast<__m256i*>(lanes[0]), vmin);
+            _mm256_store_si256(reinterpret_cast<__m256i*>(lanes[1]), vmax);
+            _mm256_store_si256(reinterpret_cast<__m256i*>(lanes[2]), vlo);
+            _mm256_store_si256(reinterpret_cast<__m256i*>(lanes[3]), vhi);
+            _mm256_store_si256(reinterpret_cast<__m256i*>(lanes[4]), vneg);
+            _mm256_store_si256(reinterpret_cast<__m256i*>(lanes[5]), vooo);
+            for (int l = 0; l < 4; ++l) {
+                p.min = std::min(p.min, lanes[0][l]);
+                p.max = std::max(p.max, lanes[1][l]);
+                p.sum_lo += static_cast<uint64_t>(lanes[2][l]);
+                p.sum_hi += static_cast<uint64_t>(lanes[3][l]);
+                p.negatives += static_cast<uint64_t>(lanes[4][l]);
+                p.out_of_order += static_cast<size_t>(lanes[5][l]);
+            }
+        }
+#endif
+        for (; i < e; ++i) {
+            int64_t v = x[i];
+            p.min = std::min(p.min, v);
+            p.max = std::max(p.max, v);
+            p.sum_lo += static_cast<uint64_t>(v) & 0xFFFFFFFFull;
+            p.sum_hi += static_cast<uint64_t>(v) >> 32;
+            p.negatives += v < 0;
+            if (i > 0) p.out_of_order += v < x[i - 1];
+        }
+        return p;
+    }
+
+    /// Reduce x[b, e) block by block, so the split sums never wrap
+    inline StatsPartial reduce_nanos(const int64_t* x, size_t b, size_t e) noexcept {
+        StatsPartial p;
+        for (size_t i = b; i < e;) {
+            size_t end = e - i > STATS_BLOCK ? i + STATS_BLOCK : e;
+            p.merge(reduce_block(x, i, end));
+            i = end;
+        }
+        return p;
+    }
+
+    /// floor(sum / n)
+    inline int64_t split_mean(const StatsPartial& p, size_t n) noexcept {
+        stats_sum sum = p.total();
+#if defined(__SIZEOF_INT128__)
+        __int128 q = sum / static_cast<__int128>(n);
+        if (sum % static_cast<__int128>(n) < 0) --q;
+        return static_cast<int64_t>(q);
+#else
+        return static_cast<int64_t>(std::floor(sum / static_cast<long double>(n)));
+#endif
+    }
+
+    /**
+     * @brief (last - first) / (n - 1) truncated toward zero, without overflow
+     * @note Saturates when the gap does not fit (two samples more than ~292 years apart)
+     */
+    inline int64_t mean_gap(int64_t first, int64_t last, size_t n) noexcept {
+        bool negative = last < first;
+        uint64_t span = negative ? static_cast<uint64_t>(first) - static_cast<uint64_t>(last)
+                                 : static_cast<uint64_t>(last) - static_cast<uint64_t>(first);
+        uint64_t gap = span / static_cast<uint64_t>(n - 1);
+        if (negative) {
+            return gap > uint64_t{1} << 63 ? std::numeric_limits<int64_t>::min() : static_cast<int64_t>(0 - gap);
+        }
+        return gap > static_cast<uint64_t>(std::numeric_limits<int64_t>::max()) ? std::numeric_limits<int64_t>::max()
+                                                                                : static_cast<int64_t>(gap);
+    }
+
+    inline TimestampStats finish_stats(const StatsPartial& p, size_t n, int64_t first, int64_t last) {
+        TimestampStats s;
+        s.count = n;
+        if (n == 0) return s;
+        s.min = DateTime::from_unix_nanos(p.min);
+        s.max = DateTime::from_unix_nanos(p.max);
+        s.mean = DateTime::from_unix_nanos(split_mean(p, n));
+        if (n > 1) {
+            // Consecutive gaps telescope: their mean is (last - first) / (n - 1)
+            s.mean_interarrival = Duration::from_nanoseconds(mean_gap(first, last, n));
+        }
+        s.out_of_order = p.out_of_order;
+        return s;
+    }
+
+} // namespace detail
+
+// ============================================================================
+// Summary Statistics
+// ============================================================================
+
+/**
+ * @brief Min, max, mean, mean inter-arrival and out-of-order count in one pass
+ * @param epoch_nanos Nanoseconds since the Unix epoch, in arrival order
+ *
+ * @details Uses AVX2 when the translation unit is compiled for it: 64-bit
+ * min/max by compare-and-blend, the sum split into 32-bit halves so lanes
+ * cannot overflow, and out-of-order detection by comparing each vector
+ * with the same vector shifted by one element. The halves are folded into
+ * a 128-bit total every 2^31 values, so the mean is exact at any length.
+ * Large inputs are split across hardware threads, so throughput is
+ * bounded by memory bandwidth.
+ */
+inline TimestampStats timestamp_stats(std::span<const int64_t> epoch_nanos) {
+    const size_t n = epoch_nanos.size();
+    if (n == 0) return {};
+    const size_t workers = detail::worker_count(n, 1u << 20);
+    std::vector<detail::StatsPartial> parts(workers);
+    detail::parallel_chunks(n, workers, [&](size_t b, size_t e, size_t w) {
+        parts[w] = detail::reduce_nanos(epoch_nanos.data(), b, e);
+    });
+    detail::StatsPartial total;
+    for (const auto& p : parts) total.merge(p);
+    return detail::finish_stats(total, n, epoch_nanos.front(), epoch_nanos.back());
+}
+
+/**
+ * @brief timestamp_stats() over DateTime values
+ * @pre Every value lies in 1677-09-21 .. 2262-04-11 (int64 nanoseconds)
+ *
+ * @details Scalar: each value is converted with to_unix_nanos() on the fly.
+ */
+inline TimestampStats timestamp_stats(std::span<const DateTime> values) {
+    const size_t n = values.size();
+    if (n == 0) return {};
+    const size_t workers = detail::worker_count(n, 1u << 18);
+    std::vector<detail::StatsPartial> parts(workers);
+    detail::parallel_chunks(n, workers, [&](size_t b, size_t e, size_t w) {
+        detail::StatsPartial& p = parts[w];
+        int64_t prev = b > 0 ? values[b - 1].to_unix_nanos() : std::numeric_limits<int64_t>::min();
+        for (size_t i = b; i < e; ++i) {
+            int64_t v = values[i].to_unix_nanos();
+            p.min = std::min(p.min, v);
+            p.max = std::max(p.max, v);
+            p.sum += v;
+            p.out_of_order += v < prev;
+            prev = v;
+        }
+    });
+    detail::StatsPartial total;
+    for (const auto& p : parts) total.merge(p);
+    return detail::finish_stats(total, n, values.front().to_unix_nanos(), values.back().to_unix_nanos());
+}
+
+// ============================================================================
+// Quantile Sketch
+// ============================================================================
+
+/**
+ * @class QuantileSketch
+ * @brief Fixed-size, one-pass approximate quantiles over int64 values
+ *
+ * @details
+ * An equal-width histogram of Bins counters that widens itself: when a
+ * value falls outside the covered bins, the bins are re-centred on the
+ * observed range, and the bin width doubles (merging neighbouring bins)
+ * only as often as needed for that range to fit. Memory is fixed at Bins
+ * counters and insertion is a shift and an increment. A quantile lies in
+ * the same bin as the exact value, interpolated inside the bin and clamped
+ * to the exact min and max, so its error is below one bin width: below
+ * 2 * (max - min) / (Bins - 1), and zero while max - min < Bins.
+ *
+ * Feed it epoch nanoseconds for timestamp quantiles, or gaps between
+ * timestamps for inter-arrival quantiles.
+ *
+ * @tparam Bins Number of counters (even, at least 4)
+ */
+template <size_t Bins = 2048>
+class QuantileSketch {
+    static_assert(Bins >= 4 && Bins % 2 == 0, "Bins must be even and at least 4");
+
+private:
+    std::array<uint64_t, Bins> counts_{};   ///< Counts per bin
+    uint64_t base_ = 0;                     ///< Absolute index of bin 0 at the current width
+    unsigned shift_ = 0;                    ///< Bin width is 2^shift_
+    uint64_t count_ = 0;
+    int64_t min_ = std::numeric_limits<int64_t>::max();
+    int64_t max_ = std::numeric_limits<int64_t>::min();
+
+    /// Order-preserving map from int64 to uint64
+    static constexpr uint64_t bias(int64_t v) noexcept { return static_cast<uint64_t>(v) ^ (uint64_t{1} << 63); }
+    static constexpr int64_t unbias(uint64_t u) noexcept { return static_cast<int64_t>(u ^ (uint64_t{1} << 63)); }
+
+    /**
+     * @brief Re-bin so that [lo, hi] (biased) fits, centred in the counters
+     * @details Keeps the width if the range still fits and only slides the
+     * bins; otherwise doubles it as often as needed, merging neighbours.
+     */
+    void rebin(uint64_t lo, uint64_t hi) noexcept {
+        unsigned s = shift_;
+        while ((hi >> s) - (lo >> s) >= Bins) ++s;   // ends by s = 63, where the span is at most 1
+
+        const uint64_t last = ~uint64_t{0} >> s;   // highest absolute bin at the new width
+        const uint64_t first = lo >> s;
+        const uint64_t slack = Bins - ((hi >> s) - first + 1);
+        uint64_t base = first > slack / 2 ? first - slack / 2 : 0;
+        base = last >= Bins ? std::min<uint64_t>(base, last - (Bins - 1)) : 0;
+
+        std::array<uint64_t, Bins> moved{};
+        for (size_t i = 0; i < Bins; ++i) {
+            if (counts_[i]) moved[((base_ + i) >> (s - shift_)) - base] += counts_[i];
+        }
+        counts_ = moved;
+        base_ = base;
+        shift_ = s;
+    }
+
+public:
+    /**
+     * @brief Add one value
+     */
+    void add(int64_t v) noexcept {
+        const uint64_t u = bias(v);
+        if (count_ == 0) {
+            base_ = u;
+            shift_ = 0;
+        } else if ((u >> shift_) < base_ || (u >> shift_) - base_ >= Bins) {
+            rebin(std::min(u, bias(min_)), std::max(u, bias(max_)));
+        }
+        ++counts_[(u >> shift_) - base_];
+        ++count_;
+        min_ = std::min(min_, v);
+        max_ = std::max(max_, v);
+    }
+
+    /**
+     * @brief Add epoch nanoseconds (or any int64 values)
+     */
+    void add(std::span<const int64_t> values) noexcept {
+        for (int64_t v : values) add(v);
+    }
+
+    /**
+     * @brief Add a timestamp
+     * @pre dt lies in 1677-09-21 .. 2262-04-11 (int64 nanoseconds)
+     */
+    void add(const DateTime& dt) noexcept { add(dt.to_unix_nanos()); }
+
+    /**
+     * @brief Add a duration
+     */
+    void add(const Duration& d) noexcept { add(d.total_nanoseconds()); }
+
+    [[nodiscard]] uint64_t count() const noexcept { return count_; }
+    [[nodiscard]] bool empty() const noexcept { return count_ == 0; }
+
+    /**
+     * @brief Approximate q-quantile of the raw values (q clamped to [0, 1])
+     * @return 0 if the sketch is empty
+     */
+    [[nodiscard]] int64_t quantile(double q) const noexcept {
+        if (count_ == 0) return 0;
+        q = std::clamp(q, 0.0, 1.0);
+        if (q == 0.0) return min_;
+        if (q == 1.0) return max_;
+        const double rank = q * static_cast<double>(count_ - 1);
+        uint64_t seen = 0;
+        for (size_t i = 0; i < Bins; ++i) {
+            if (counts_[i] == 0) continue;
+            if (static_cast<double>(seen + counts_[i]) > rank) {
+                const int64_t lower = unbias((base_ + i) << shift_);
+                if (shift_ == 0) return std::clamp(lower, min_, max_);
+                const double width = std::ldexp(1.0, static_cast<int>(shift_));
+                const double within = (rank - static_cast<double>(seen) + 0.5) / static_cast<double>(counts_[i]);
+                const auto offset = static_cast<uint64_t>(std::min(within * width, width - 1.0));
+                return std::clamp(static_cast<int64_t>(static_cast<uint64_t>(lower) + offset), min_, max_);
+            }
+            seen += counts_[i];
+        }
+        return max_;
+    }
+
+    /**
+     * @brief quantile() of timestamps fed as epoch nanoseconds
+     */
+    [[nodiscard]] DateTime quantile_datetime(double q) const noexcept { return DateTime::from_unix_nanos(quantile(q)); }
+
+    /**
+     * @brief quantile() of durations or gaps fed as nanoseconds
+     */
+    [[nodiscard]] Duration quantile_duration(double q) const noexcept { return Duration::from_nanoseconds(quantile(q)); }
+};
+
+} // namespace zuu
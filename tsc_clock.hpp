@@ -0,0 +1,311 @@
+/**
+ * @file tsc_clock.hpp
+ * @brief Wall clock read from the CPU time-stamp counter
+ * @author zuudevs (zuudevs@gmail.com)
+ * @version 1.1.1
+ * @date 2026-10-16
+ */
+
+#pragma once
+
+#include "datetime_core.hpp"
+#include <atomic>
+#include <chrono>
+#include <thread>
+
+#if defined(__x86_64__) || defined(__i386__) || defined(_M_X64) || defined(_M_IX86)
+    #define ZUU_HAS_TSC 1
+    #if defined(_MSC_VER)
+        #include <intrin.h>
+    #else
+        #include <cpuid.h>
+        #include <x86intrin.h>
+    #endif
+#else
+    #define ZUU_HAS_TSC 0
+#endif
+
+namespace zuu {
+
+namespace detail {
+
+    /// (delta * mult) >> shift with a 128-bit intermediate
+    inline int64_t mul_shift(int64_t delta, uint64_t mult, int shift) noexcept {
+#if defined(__SIZEOF_INT128__)
+        return static_cast<int64_t>((static_cast<__int128>(delta) * static_cast<__int128>(mult)) >> shift);
+#elif defined(_MSC_VER) && defined(_M_X64)
+        int64_t hi = 0;
+        uint64_t lo = static_cast<uint64_t>(_mul128(delta, static_cast<int64_t>(mult), &hi));
+        return static_cast<int64_t>(__shiftright128(lo, static_cast<uint64_t>(hi), static_cast<unsigned char>(shift)));
+#else
+        return static_cast<int64_t>(static_cast<long double>(delta) * static_cast<long double>(mult) /
+                                    static_cast<long double>(uint64_t{1} << shift));
+#endif
+    }
+
+    /// CLOCK_REALTIME as Unix nanoseconds
+    inline int64_t realtime_nanos() noexcept {
+        return std::chrono::duration_cast<std::chrono::nanoseconds>(
+            std::chrono::system_clock::now().time_since_epoch()).count();
+    }
+
+} // namespace detail
+
+/**
+ * @class TscClock
+ * @brief Wall clock read with rdtsc and scaled by a calibrated multiply-shift
+ *
+ * @details
+ * The constructor measures the TSC rate against CLOCK_REALTIME over a short
+ * window. Afterwards a reading costs one rdtsc and one multiply:
+ *
+ *     ns = base_ns + ((ticks - base_ticks) * mult) >> 32
+ *
+ * Call recalibrate() (or recalibrate_if_due() from a housekeeping loop) to
+ * re-measure the rate and re-anchor the offset; the error it corrects is
+ * recorded in stats(). Rebasing steps the clock by that error, so readings
+ * across a recalibration are not guaranteed monotonic.
+ *
+ * Without an invariant TSC (non-x86, or a TSC that stops or changes rate
+ * with power states) every reading falls back to CLOCK_REALTIME, and
+ * stamp() returns Unix nanoseconds that to_nanos() passes through.
+ *
+ * Reads are safe from any thread; recalibration must come from one thread
+ * at a time. Keep raw stamp() values on the hot path and convert with
+ * to_nanos() or to_datetime() only when a value is displayed.
+ *
+ * @code
+ * zuu::TscClock clock;
+ * uint64_t stamp = clock.stamp();                   // per packet
+ * ...
+ * std::cout << clock.to_datetime(stamp).to_iso8601_ns();
+ * @endcode
+ */
+class TscClock {
+public:
+    /**
+     * @brief Calibration and drift counters
+     */
+    struct Stats {
+        uint64_t calibrations = 0;      ///< Number of calibrations, including the initial one
+        int64_t last_drift_ns = 0;      ///< Predicted minus actual wall time at the last recalibration
+        int64_t max_abs_drift_ns = 0;   ///< Largest |drift| seen
+        double ticks_per_second = 0;    ///< Current rate estimate (0 in fallback mode)
+    };
+
+private:
+    static constexpr int SHIFT = 32;
+
+    // Seqlock-protected conversion parameters
+    mutable std::atomic<uint32_t> seq_{0};
+    std::atomic<uint64_t> base_ticks_{0};
+    std::atomic<int64_t> base_ns_{0};
+    std::atomic<uint64_t> mult_{0};
+
+    bool use_tsc_ = false;
+    uint64_t interval_ticks_ = 0;
+    uint64_t next_calibration_ = 0;
+    Stats stats_;
+
+    struct Sample {
+        uint64_t ticks;
+        int64_t nanos;
+    };
+
+    /// Pair a TSC reading with CLOCK_REALTIME, keeping the tightest bracket
+    static Sample sample() noexcept {
+        Sample best{0, 0};
+        uint64_t best_gap = UINT64_MAX;
+        for (int i = 0; i < 7; ++i) {
+            uint64_t t0 = ticks();
+            int64_t ns = detail::realtime_nanos();
+            uint64_t t1 = ticks();
+            if (t1 - t0 < best_gap) {
+                best_gap = t1 - t0;
+                best = {t0 + (t1 - t0) / 2, ns};
+            }
+        }
+        return best;
+    }
+
+    void publish(uint64_t base_ticks, int64_t base_ns, uint64_t mult) noexcept {
+        uint32_t s = seq_.load(std::memory_order_relaxed);
+        seq_.store(s + 1, std::memory_order_relaxed);
+        std::atomic_thread_fence(std::memory_order_release);
+        base_ticks_.store(base_ticks, std::memory_order_relaxed);
+        base_ns_.store(base_ns, std::memory_order_relaxed);
+        mult_.store(mult, std::memory_order_relaxed);
+        seq_.store(s + 2, std::memory_order_release);
+    }
+
+    static uint64_t rate_mult(const Sample& a, const Sample& b) noexcept {
+        uint64_t dt = b.ticks - a.ticks;
+        uint64_t dn = static_cast<uint64_t>(b.nanos - a.nanos);
+        return dt == 0 ? 0 : static_cast<uint64_t>((static_cast<long double>(dn) * (uint64_t{1} << SHIFT)) /
+                                                   static_cast<long double>(dt));
+    }
+
+public:
+    /**
+     * @brief Calibrate against CLOCK_REALTIME
+     * @param window Initial measurement window (longer is more accurate)
+     * @param interval Period used by recalibrate_if_due()
+     */
+    explicit TscClock(std::chrono::nanoseconds window = std::chrono::milliseconds(20),
+                      std::chrono::nanoseconds interval = std::chrono::seconds(1)) {
+        use_tsc_ = invariant_tsc();
+        if (!use_tsc_) return;
+
+        Sample a = sample();
+        std::this_thread::sleep_for(window);
+        Sample b = sample();
+        uint64_t mult = rate_mult(a, b);
+        if (mult == 0 || b.nanos <= a.nanos) {
+            use_tsc_ = false;
+            return;
+        }
+        publish(b.ticks, b.nanos, mult);
+        stats_.calibrations = 1;
+        stats_.ticks_per_second = 1e9 * static_cast<double>(uint64_t{1} << SHIFT) / static_cast<double>(mult);
+        interval_ticks_ = static_cast<uint64_t>(stats_.ticks_per_second * 1e-9 * static_cast<double>(interval.count()));
+        next_calibration_ = b.ticks + interval_ticks_;
+    }
+
+    TscClock(const TscClock&) = delete;
+    TscClock& operator=(const TscClock&) = delete;
+
+    /**
+     * @brief Check for an invariant TSC (CPUID 8000_0007h EDX bit 8)
+     */
+    [[nodiscard]] static bool invariant_tsc() noexcept {
+#if ZUU_HAS_TSC
+    #if defined(_MSC_VER)
+        int regs[4] = {};
+        __cpuid(regs, static_cast<int>(0x80000000u));
+        if (static_cast<unsigned>(regs[0]) < 0x80000007u) return false;
+        __cpuid(regs, static_cast<int>(0x80000007u));
+        return (regs[3] >> 8) & 1;
+    #else
+        unsigned eax = 0, ebx = 0, ecx = 0, edx = 0;
+        if (!__get_cpuid(0x80000007u, &eax, &ebx, &ecx, &edx)) return false;
+        return (edx >> 8) & 1;
+    #endif
+#else
+        return false;
+#endif
+    }
+
+    /**
+     * @brief Read the raw time-stamp counter (0 where there is none)
+     */
+    [[nodiscard]] static uint64_t ticks() noexcept {
+#if ZUU_HAS_TSC
+        return __rdtsc();
+#else
+        return 0;
+#endif
+    }
+
+    /**
+     * @brief Read the counter after all earlier instructions have completed (rdtscp)
+     */
+    [[nodiscard]] static uint64_t ticks_ordered() noexcept {
+#if ZUU_HAS_TSC
+        unsigned aux = 0;
+        return __rdtscp(&aux);
+#else
+        return 0;
+#endif
+    }
+
+    /**
+     * @brief Take a stamp for later conversion with to_nanos() / to_datetime()
+     * @return ticks() with an invariant TSC, otherwise CLOCK_REALTIME Unix nanoseconds
+     */
+    [[nodiscard]] uint64_t stamp() const noexcept {
+        return use_tsc_ ? ticks() : static_cast<uint64_t>(detail::realtime_nanos());
+    }
+
+    /**
+     * @brief Check if readings come from the TSC rather than the fallback
+     */
+    [[nodiscard]] bool is_tsc() const noexcept { return use_tsc_; }
+
+    /**
+     * @brief Convert a stamp() value to Unix nanoseconds
+     * @note In fallback mode the stamp already is Unix nanoseconds and is returned unchanged
+     */
+    [[nodiscard]] int64_t to_nanos(uint64_t t) const noexcept {
+        if (!use_tsc_) return static_cast<int64_t>(t);
+        uint32_t s0 = 0;
+        uint64_t base_ticks = 0, mult = 0;
+        int64_t base_ns = 0;
+        do {
+            s0 = seq_.load(std::memory_order_acquire);
+            base_ticks = base_ticks_.load(std::memory_order_relaxed);
+            base_ns = base_ns_.load(std::memory_order_relaxed);
+            mult = mult_.load(std::memory_order_relaxed);
+            std::atomic_thread_fence(std::memory_order_acquire);
+        } while ((s0 & 1) || seq_.load(std::memory_order_relaxed) != s0);
+        return base_ns + detail::mul_shift(static_cast<int64_t>(t - base_ticks), mult, SHIFT);
+    }
+
+    /**
+     * @brief Current time as Unix nanoseconds
+     */
+    [[nodiscard]] int64_t now_nanos() const noexcept {
+        return use_tsc_ ? to_nanos(ticks()) : detail::realtime_nanos();
+    }
+
+    /**
+     * @brief Convert a stamp() value to a DateTime (for display)
+     */
+    [[nodiscard]] DateTime to_datetime(uint64_t t) const noexcept {
+        return DateTime::from_unix_nanos(to_nanos(t));
+    }
+
+    /**
+     * @brief Current time as a DateTime
+     */
+    [[nodiscard]] DateTime now() const noexcept { return DateTime::from_unix_nanos(now_nanos()); }
+
+    /**
+     * @brief Re-measure the rate since the last calibration and re-anchor
+     * @return Drift corrected: predicted minus actual wall time, in nanoseconds
+     */
+    int64_t recalibrate() noexcept {
+        if (!use_tsc_) return 0;
+        Sample s = sample();
+        int64_t drift = to_nanos(s.ticks) - s.nanos;
+
+        Sample base{base_ticks_.load(std::memory_order_relaxed), base_ns_.load(std::memory_order_relaxed)};
+        uint64_t mult = s.nanos > base.nanos ? rate_mult(base, s) : 0;
+        if (mult == 0) mult = mult_.load(std::memory_order_relaxed);
+        publish(s.ticks, s.nanos, mult);
+
+        ++stats_.calibrations;
+        stats_.last_drift_ns = drift;
+        int64_t mag = drift < 0 ? -drift : drift;
+        stats_.max_abs_drift_ns = mag > stats_.max_abs_drift_ns ? mag : stats_.max_abs_drift_ns;
+        stats_.ticks_per_second = 1e9 * static_cast<double>(uint64_t{1} << SHIFT) / static_cast<double>(mult);
+        next_calibration_ = s.ticks + interval_ticks_;
+        return drift;
+    }
+
+    /**
+     * @brief Recalibrate if the configured interval has elapsed (one rdtsc otherwise)
+     * @return true if a recalibration ran
+     */
+    bool recalibrate_if_due() noexcept {
+        if (!use_tsc_ || ticks() < next_calibration_) return false;
+        recalibrate();
+        return true;
+    }
+
+    /**
+     * @brief Get calibration and drift counters
+     */
+    [[nodiscard]] const Stats& stats() const noexcept { return stats_; }
+};
+
+} // namespace zuu